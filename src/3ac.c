@@ -14,6 +14,7 @@
 #include "3ac.h"
 #include "debug.h"
 #include "memory_manager.h"
+#include "intern.h"
 
 static const char* opcodes_str[] = {
 	FOREACH_OPCODE(GENERATE_STRING) ""
@@ -25,9 +26,30 @@ DLList* func_il = NULL;
 
 const char* scope_prefix[3] = {"GF@", "LF@", "TF@"};
 
-Instruction* instruction_init(opcode_e operation, Address addr1, Address addr2, Address addr3) {
-	Instruction* inst = (Instruction*) mm_malloc(sizeof(Instruction));
+static MemArena* il_arena = NULL;  /// Arena holding instructions and their addresses
+
+/**
+ * Allocate memory for instruction list content, from arena if instruction lists are initialized
+ * @param size Number of bytes to allocate
+ * @return allocated memory
+ */
+static void* il_alloc(size_t size) {
+	if (il_arena == NULL)
+		return mm_malloc(size);
+	return mm_arena_alloc(il_arena, size);
+}
 
+/**
+ * Free memory allocated by il_alloc
+ * @param ptr Allocated memory
+ */
+static void il_dealloc(void* ptr) {
+	// Arena memory is released all at once in il_free
+	if (il_arena == NULL)
+		mm_free(ptr);
+}
+
+Instruction* instruction_init(opcode_e operation, Address addr1, Address addr2, Address addr3) {
 	if (addr1.type == ADDR_TYPE_ERROR ||
 		addr2.type == ADDR_TYPE_ERROR ||
 		addr3.type == ADDR_TYPE_ERROR)
@@ -35,10 +57,11 @@ Instruction* instruction_init(opcode_e operation, Address addr1, Address addr2,
 		address_free(addr1);
 		address_free(addr2);
 		address_free(addr3);
-		mm_free(inst);
 		return NULL;
 	}
 
+	Instruction* inst = (Instruction*) il_alloc(sizeof(Instruction));
+
 	inst->operation = operation;
 	inst->addresses[0] = addr1;
 	inst->addresses[1] = addr2;
@@ -53,16 +76,14 @@ void instruction_free(void* inst) {
 		address_free(instruction->addresses[i]);
 	}
 
-	mm_free(inst);
+	il_dealloc(inst);
 }
 
 Address addr_symbol(const char* prefix, const char* symbol) {
 	Address addr;
 
-	addr.symbol = (char*) mm_malloc(sizeof(char) * (strlen(prefix) + strlen(symbol) + 1));
-
-	strcpy(addr.symbol, prefix);
-	strcat(addr.symbol, symbol);
+	addr.prefix = prefix;
+	addr.symbol = intern(symbol);
 	addr.type = ADDR_TYPE_SYMBOL;
 
 	return addr;
@@ -71,7 +92,14 @@ Address addr_symbol(const char* prefix, const char* symbol) {
 Address addr_constant(Token token) {
 	Address addr;
 
-	addr.constant = token_copy(&token);
+	addr.prefix = NULL;
+	addr.constant = (Token*) il_alloc(sizeof(Token));
+	*addr.constant = token;
+	addr.constant->borrowed = false;
+	if (token.id == TOKEN_STRING || token.id == TOKEN_IDENTIFIER) {
+		addr.constant->data.str = (char*) il_alloc(sizeof(char) * (strlen(token.data.str) + 1));
+		strcpy(addr.constant->data.str, token.data.str);
+	}
 
 	addr.type = ADDR_TYPE_CONST;
 
@@ -80,11 +108,12 @@ Address addr_constant(Token token) {
 
 void address_free(Address addr) {
 	switch (addr.type) {
-		case ADDR_TYPE_SYMBOL:
-			mm_free(addr.symbol);
+		case ADDR_TYPE_SYMBOL:  // Symbols are interned
 			break;
 		case ADDR_TYPE_CONST:
-			token_free(addr.constant);
+			if (addr.constant->id == TOKEN_STRING || addr.constant->id == TOKEN_IDENTIFIER)
+				il_dealloc(addr.constant->data.str);
+			il_dealloc(addr.constant);
 			break;
 		default:
 			break;
@@ -92,15 +121,22 @@ void address_free(Address addr) {
 }
 
 void il_init() {
-	main_il = dllist_init(instruction_free);
-	func_il = dllist_init(instruction_free);
-	global_il = dllist_init(instruction_free);
+	il_arena = mm_arena_create(IL_ARENA_CHUNK_SIZE);
+
+	// Instructions are freed together with the arena
+	main_il = dllist_init(NULL);
+	func_il = dllist_init(NULL);
+	global_il = dllist_init(NULL);
 }
 
 void il_free() {
 	dllist_free(main_il);
 	dllist_free(func_il);
 	dllist_free(global_il);
+	main_il = func_il = global_il = NULL;
+
+	mm_arena_destroy(il_arena);
+	il_arena = NULL;
 }
 
 void il_add(DLList* il, Instruction* instruction) {
@@ -122,7 +158,7 @@ static void print_instruction(Instruction* instruction) {
 	for (int i = 0; i < MAX_ADDRESSES; ++i) {
 		switch (instruction->addresses[i].type) {
 			case ADDR_TYPE_SYMBOL:
-				printf("%s ", instruction->addresses[i].symbol);
+				printf("%s%s ", instruction->addresses[i].prefix, instruction->addresses[i].symbol);
 				break;
 			case ADDR_TYPE_CONST:
 				switch (instruction->addresses[i].constant->id) {
@@ -203,7 +239,7 @@ void instruction_debug(void *inst) {
 		for (int i = 0; i < MAX_ADDRESSES; ++i) {
 			switch (instruction->addresses[i].type) {
 				case ADDR_TYPE_SYMBOL:
-					debug("%s ", instruction->addresses[i].symbol);
+					debug("%s%s ", instruction->addresses[i].prefix, instruction->addresses[i].symbol);
 					break;
 				case ADDR_TYPE_CONST:
 					switch (instruction->addresses[i].constant->id) {
@@ -76,7 +76,7 @@
 #define GENERATE_ENUM(ENUM) OP_##ENUM,
 #define GENERATE_STRING(STR) #STR,
 
-#define NO_ADDR ((Address) {.type = ADDR_TYPE_EMPTY, {NULL}})
+#define NO_ADDR ((Address) {.type = ADDR_TYPE_EMPTY, NULL, {NULL}})
 #define F_GLOBAL scope_prefix[0]
 #define F_LOCAL scope_prefix[1]
 #define F_TMP scope_prefix[2]
@@ -91,6 +91,7 @@
 
 
 #define MAX_ADDRESSES 3
+#define IL_ARENA_CHUNK_SIZE 65536
 
 /**
  * Enum of operation codes
@@ -114,9 +115,10 @@ typedef enum {
  */
 typedef struct address_t {
     addr_type_e type;  /// Type of address, used to determine the value of address
+    const char* prefix;  /// Frame prefix (GF@, LF@, TF@) or label prefix of symbol
 
     union {
-        char* symbol;  /// Symbol identifier with frame prefix (GF@, LF@, TF@)
+        const char* symbol;  /// Interned symbol identifier
         Token* constant;  /// Constant in token form
     };
 } Address;
@@ -152,8 +154,8 @@ void instruction_free(void* inst);
 
 /**
  * Create new address for given symbol
- * @param prefix symbol prefix ("GF@", "LF@", "TF@")
- * @param symbol identifier (will be copied)
+ * @param prefix symbol prefix ("GF@", "LF@", "TF@"), has to be string literal (it is not copied)
+ * @param symbol identifier (will be interned)
  * @return Address
  */
 Address addr_symbol(const char* prefix, const char* symbol);
@@ -172,12 +174,13 @@ Address addr_constant(Token token);
 void address_free(Address addr);
 
 /**
- * Initialize instruction list
+ * Initialize instruction lists, instructions and addresses are allocated
+ * from one arena from now on until il_free is called
  */
 void il_init();
 
 /**
- * Free instruction list
+ * Free instruction lists together with all instructions
  */
 void il_free();
 
@@ -15,19 +15,21 @@
 #include "memory_manager.h"
 
 
-static void buffer_realloc(Buffer* b, size_t size) {
-	if (size == b->buffer_size)
+/**
+ * Grow buffer so it can hold at least given number of bytes, capacity is at least doubled
+ * @param b buffer
+ * @param size Minimal capacity
+ */
+static void buffer_grow(Buffer* b, size_t size) {
+	if (size <= b->buffer_size)
 		return;
 
-	b->str = (char*) mm_realloc(b->str, size);
+	size_t new_size = b->buffer_size * 2;
+	if (new_size < size)
+		new_size = size;
 
-	if (size < b->buffer_size) {
-		b->len = 0;
-		if (size != 0)
-			b->str[0] = '\0';
-	}
-
-	b->buffer_size = size;
+	b->str = (char*) mm_realloc(b->str, new_size);
+	b->buffer_size = new_size;
 }
 
 Buffer* buffer_init(size_t size) {
@@ -52,11 +54,17 @@ void buffer_free(Buffer* b) {
 	mm_free(b);
 }
 
+void buffer_reserve(Buffer* b, size_t len) {
+	assert(b != NULL);
+
+	buffer_grow(b, len + 1);
+}
+
 void buffer_append_c(Buffer* b, char c) {
 	assert(b != NULL);
 
 	if (b->len + 1 >= b->buffer_size) {
-		buffer_realloc(b, b->buffer_size + BUFFER_CHUNK);
+		buffer_grow(b, b->len + 2);
 	}
   
 	b->str[b->len] = c;
@@ -64,39 +72,32 @@ void buffer_append_c(Buffer* b, char c) {
 	b->len++;
 }
 
-void buffer_append_str(Buffer* b, const char* str) {
+void buffer_append_n(Buffer* b, const char* str, size_t n) {
 	assert(b != NULL);
 
-	size_t str_len = strlen(str);
+	buffer_grow(b, b->len + n + 1);
 
-	if (b->len + str_len + 1 > b->buffer_size) {
-		buffer_realloc(b, b->len + strlen(str) + 1);
-	}
+	memcpy(b->str + b->len, str, n);
+	b->len += n;
+	b->str[b->len] = '\0';
+}
 
-	strcat(b->str, str);
-	b->len += str_len;
+void buffer_append_str(Buffer* b, const char* str) {
+	buffer_append_n(b, str, strlen(str));
 }
 
 void buffer_clear(Buffer* b) {
 	assert(b != NULL);
 
-	buffer_realloc(b, BUFFER_CHUNK);
-
 	b->str[0] = '\0';
 	b->len = 0;
-	b->buffer_size = BUFFER_CHUNK;
 }
 
 void buffer_set_str(Buffer* b, const char* str) {
 	assert(b != NULL);
 
-	size_t str_len = strlen(str);
-
-	if (str_len + 1 > b->buffer_size)
-		buffer_realloc(b, strlen(str) + 1);
-
-	strcpy(b->str, str);
-	b->len = str_len;
+	b->len = 0;
+	buffer_append_str(b, str);
 }
 
 void buffer_debug(void* b) {
@@ -19,8 +19,8 @@
  * Buffer object structure
  *
  * Buffer allocates more memory than needed, to avoid large amount
- * of reallocations. Buffer is reallocated by BUFFER_CHUNK only
- * when it runs out of memory.
+ * of reallocations. Buffer capacity is doubled when it runs out
+ * of memory and it is never shrunk.
  *
  * Buffer always holds a valid C string in arr. Buffer takes
  * care of appending '\0' at the end of the string.
@@ -60,7 +60,22 @@ void buffer_append_c(Buffer* b, char c);
 void buffer_append_str(Buffer* b, const char* str);
 
 /**
- * Reallocates buffer to default size and sets length to 0
+ * Append first n characters of given string to buffer
+ * @param b buffer
+ * @param str characters to append (does not have to be terminated by '\0')
+ * @param n number of characters to append
+ */
+void buffer_append_n(Buffer* b, const char* str, size_t n);
+
+/**
+ * Make sure buffer can hold string of given length without reallocation
+ * @param b buffer
+ * @param len string length
+ */
+void buffer_reserve(Buffer* b, size_t len);
+
+/**
+ * Sets length to 0, allocated memory is kept for next use
  * @param b buffer
  */
 void buffer_clear(Buffer* b);
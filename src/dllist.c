@@ -58,7 +58,7 @@ DLList* dllist_copy(DLList *l) {
 void dllist_insert_first(DLList *l, void *data) {
 	assert(l != NULL);
 
-	DLListItem* new_item = (DLListItem*) mm_malloc(sizeof(DLListItem));
+	DLListItem* new_item = (DLListItem*) mm_pool_malloc(sizeof(DLListItem));
 
 	new_item->data = data;
 	new_item->prev = NULL;
@@ -77,7 +77,7 @@ void dllist_insert_first(DLList *l, void *data) {
 void dllist_insert_last(DLList *l, void *data) {
 	assert(l != NULL);
 
-	DLListItem* new_item = (DLListItem*) mm_malloc(sizeof(DLListItem));
+	DLListItem* new_item = (DLListItem*) mm_pool_malloc(sizeof(DLListItem));
 
 	new_item->data = data;
 	new_item->next = NULL;
@@ -99,7 +99,7 @@ void dllist_post_insert(DLList *l, void *data) {
 	if (l->active == NULL)
 		return;
 
-	DLListItem* new_item = (DLListItem*) mm_malloc(sizeof(DLListItem));
+	DLListItem* new_item = (DLListItem*) mm_pool_malloc(sizeof(DLListItem));
 
 	new_item->data = data;
 	new_item->next = l->active->next;
@@ -120,7 +120,7 @@ void dllist_pre_insert(DLList *l, void *data) {
 	if (l->active == NULL)
 		return;
 
-	DLListItem* new_item = (DLListItem*) mm_malloc(sizeof(DLListItem));
+	DLListItem* new_item = (DLListItem*) mm_pool_malloc(sizeof(DLListItem));
 
 	new_item->data = data;
 	new_item->next = l->active;
@@ -192,7 +192,7 @@ void* dllist_delete_first(DLList *l) {
 	else
 		l->last = NULL;
 
-	mm_free(to_delete);
+	mm_pool_free(to_delete, sizeof(DLListItem));
 	return data;
 }
 
@@ -214,7 +214,7 @@ void* dllist_delete_last(DLList *l) {
 	else
 		l->first = NULL;
 
-	mm_free(to_delete);
+	mm_pool_free(to_delete, sizeof(DLListItem));
 	return data;	
 }
 
@@ -250,7 +250,7 @@ void* dllist_delete_and_succ(DLList *l) {
 
 	l->active = l->active->next;
 
-	mm_free(to_delete);
+	mm_pool_free(to_delete, sizeof(DLListItem));
 	return data;
 }
 
@@ -286,7 +286,7 @@ void* dllist_delete_and_pred(DLList *l) {
 
 	l->active = l->active->prev;
 
-	mm_free(to_delete);
+	mm_pool_free(to_delete, sizeof(DLListItem));
 	return data;
 }
 
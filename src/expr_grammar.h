@@ -17,7 +17,8 @@
 #define NUM_OF_EXPR_RULES 27
 
 /**
- * Enum determining index of a given token in the Precedence Table
+ * Enum determining row/column of a given token in the Precedence Table of expr_grammar.def,
+ * tokens are mapped to it when the table is generated
  */
 typedef enum {
 // ARITHMETIC OPERATORS
@@ -63,29 +64,31 @@ typedef enum {
 	EXPR_SUCCESS
 } pt_item_e;
 
-/**
- * Global operator-precedence grammar. Needs to be initialized
- */
-extern struct expr_grammar_t {
-	Rule* rules[NUM_OF_EXPR_RULES];
-	unsigned** precedence_table;	/// 2D array representing Precedence Table
-} expr_grammar;
+/// Number of precedence table rows/columns, one for each terminal and stack marker (they are indexed by symbol directly)
+#define PT_SYMBOLS (EXPR_HANDLE_MARKER + 1 - TERMINALS_START)
 
-/**
- * Initialize operator-precedence grammar
- */
-void expr_grammar_init();
+/// Get action (pt_item_e) from precedence table for topmost terminal on stack and token
+#define PT_GET(top, token) \
+	(expr_grammar.precedence_table[((top) - TERMINALS_START) * PT_SYMBOLS + ((token) - TERMINALS_START)])
 
-/**
- * Free expression grammar
- */
-void expr_grammar_free();
+/// Number of reduction trie columns, one for each symbol which can be on expression stack
+#define EXPR_TRIE_COLUMNS (EXPR_HANDLE_MARKER + 1 - NT_EXPRESSION)
+
+/// Rule of reduction trie node which is not the end of any production
+#define EXPR_TRIE_NO_RULE NUM_OF_EXPR_RULES
+
+/// Get child of reduction trie node for next symbol of handle, 0 if there is no rule with such production
+#define EXPR_TRIE_NEXT(node, symbol) \
+	(expr_grammar.reduction_trie[(node) * EXPR_TRIE_COLUMNS + ((symbol) - NT_EXPRESSION)])
 
 /**
- * Map token to row/column in Precedence Table
- * @param token token to map index to
- * @return index of column/row
+ * Global operator-precedence grammar, constant tables generated from expr_grammar.def
  */
-unsigned pt_map_token(unsigned token);
+extern const struct expr_grammar_t {
+	const Rule* rules;	/// Array of NUM_OF_EXPR_RULES rules
+	const unsigned char* precedence_table;	/// Flat precedence table, PT_SYMBOLS rows of PT_SYMBOLS items, use PT_GET
+	const unsigned char* reduction_trie;	/// Trie of productions from the top of the stack, root is node 0, use EXPR_TRIE_NEXT
+	const unsigned char* trie_rules;	/// Index of rule of each trie node, EXPR_TRIE_NO_RULE if there is none
+} expr_grammar;
 
 #endif //IFJ17_COMPILER_PREC_GRAMMAR_H
@@ -0,0 +1,693 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+/*
+ * Rules and precedence table of the operator-precedence grammar
+ *
+ * GENERATED by tools/gen_grammar_tables.c from expr_grammar.def, do not edit.
+ */
+
+#ifndef IFJ17_COMPILER_EXPR_GRAMMAR_TABLES_H
+#define IFJ17_COMPILER_EXPR_GRAMMAR_TABLES_H
+
+/// Tables are valid only for enums they were generated with
+typedef char expr_grammar_tables_check[NT_ENUM_SIZE == 39 && TOKEN_ENUM_END == 104 && PT_INDEX_ENUM_SIZE == 21 ? 1 : -1];
+
+/// Productions of rules (in order they are pushed on stack), each ends by END_OF_RULE
+static const uint16_t expr_grammar_productions[] = {
+	// 0: NT_EXPRESSION -> TOKEN_RPAR, TOKEN_LPAR, TOKEN_IDENTIFIER
+	TOKEN_RPAR, TOKEN_LPAR, TOKEN_IDENTIFIER, END_OF_RULE,
+	// 1: NT_EXPRESSION -> TOKEN_RPAR, NT_EXPRESSION, TOKEN_LPAR, TOKEN_IDENTIFIER
+	TOKEN_RPAR, NT_EXPRESSION, TOKEN_LPAR, TOKEN_IDENTIFIER, END_OF_RULE,
+	// 2: NT_EXPRESSION -> TOKEN_RPAR, NT_LIST, TOKEN_LPAR, TOKEN_IDENTIFIER
+	TOKEN_RPAR, NT_LIST, TOKEN_LPAR, TOKEN_IDENTIFIER, END_OF_RULE,
+	// 3: NT_LIST -> NT_EXPRESSION, TOKEN_COMMA, NT_LIST
+	NT_EXPRESSION, TOKEN_COMMA, NT_LIST, END_OF_RULE,
+	// 4: NT_LIST -> NT_EXPRESSION, TOKEN_COMMA, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_COMMA, NT_EXPRESSION, END_OF_RULE,
+	// 5: NT_EXPRESSION -> TOKEN_IDENTIFIER
+	TOKEN_IDENTIFIER, END_OF_RULE,
+	// 6: NT_EXPRESSION -> TOKEN_STRING
+	TOKEN_STRING, END_OF_RULE,
+	// 7: NT_EXPRESSION -> TOKEN_INT
+	TOKEN_INT, END_OF_RULE,
+	// 8: NT_EXPRESSION -> TOKEN_REAL
+	TOKEN_REAL, END_OF_RULE,
+	// 9: NT_EXPRESSION -> TOKEN_KW_TRUE
+	TOKEN_KW_TRUE, END_OF_RULE,
+	// 10: NT_EXPRESSION -> TOKEN_KW_FALSE
+	TOKEN_KW_FALSE, END_OF_RULE,
+	// 11: NT_EXPRESSION -> TOKEN_RPAR, NT_EXPRESSION, TOKEN_LPAR
+	TOKEN_RPAR, NT_EXPRESSION, TOKEN_LPAR, END_OF_RULE,
+	// 12: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_UNARY_MINUS
+	NT_EXPRESSION, TOKEN_UNARY_MINUS, END_OF_RULE,
+	// 13: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_ADD, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_ADD, NT_EXPRESSION, END_OF_RULE,
+	// 14: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_SUB, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_SUB, NT_EXPRESSION, END_OF_RULE,
+	// 15: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_MUL, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_MUL, NT_EXPRESSION, END_OF_RULE,
+	// 16: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_DIVI, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_DIVI, NT_EXPRESSION, END_OF_RULE,
+	// 17: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_DIVR, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_DIVR, NT_EXPRESSION, END_OF_RULE,
+	// 18: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_EQUAL, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_EQUAL, NT_EXPRESSION, END_OF_RULE,
+	// 19: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_NE, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_NE, NT_EXPRESSION, END_OF_RULE,
+	// 20: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_GT, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_GT, NT_EXPRESSION, END_OF_RULE,
+	// 21: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_GE, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_GE, NT_EXPRESSION, END_OF_RULE,
+	// 22: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_LT, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_LT, NT_EXPRESSION, END_OF_RULE,
+	// 23: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_LE, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_LE, NT_EXPRESSION, END_OF_RULE,
+	// 24: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_KW_NOT
+	NT_EXPRESSION, TOKEN_KW_NOT, END_OF_RULE,
+	// 25: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_KW_AND, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_KW_AND, NT_EXPRESSION, END_OF_RULE,
+	// 26: NT_EXPRESSION -> NT_EXPRESSION, TOKEN_KW_OR, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_KW_OR, NT_EXPRESSION, END_OF_RULE,
+};
+
+/// Rules of grammar
+static const Rule expr_grammar_rule_table[NUM_OF_EXPR_RULES] = {
+	{NT_EXPRESSION, &expr_grammar_productions[0], 3, sem_expr_func},
+	{NT_EXPRESSION, &expr_grammar_productions[4], 4, sem_expr_func},
+	{NT_EXPRESSION, &expr_grammar_productions[9], 4, sem_expr_func},
+	{NT_LIST, &expr_grammar_productions[14], 3, sem_expr_list_expr},
+	{NT_LIST, &expr_grammar_productions[18], 3, sem_expr_list},
+	{NT_EXPRESSION, &expr_grammar_productions[22], 1, sem_expr_id},
+	{NT_EXPRESSION, &expr_grammar_productions[24], 1, sem_expr_const},
+	{NT_EXPRESSION, &expr_grammar_productions[26], 1, sem_expr_const},
+	{NT_EXPRESSION, &expr_grammar_productions[28], 1, sem_expr_const},
+	{NT_EXPRESSION, &expr_grammar_productions[30], 1, sem_expr_const},
+	{NT_EXPRESSION, &expr_grammar_productions[32], 1, sem_expr_const},
+	{NT_EXPRESSION, &expr_grammar_productions[34], 3, sem_expr_brackets},
+	{NT_EXPRESSION, &expr_grammar_productions[38], 2, sem_expr_unary},
+	{NT_EXPRESSION, &expr_grammar_productions[41], 3, sem_expr_aritmetic_basic},
+	{NT_EXPRESSION, &expr_grammar_productions[45], 3, sem_expr_aritmetic_basic},
+	{NT_EXPRESSION, &expr_grammar_productions[49], 3, sem_expr_aritmetic_basic},
+	{NT_EXPRESSION, &expr_grammar_productions[53], 3, sem_expr_div},
+	{NT_EXPRESSION, &expr_grammar_productions[57], 3, sem_expr_div},
+	{NT_EXPRESSION, &expr_grammar_productions[61], 3, sem_expr_eq_ne},
+	{NT_EXPRESSION, &expr_grammar_productions[65], 3, sem_expr_eq_ne},
+	{NT_EXPRESSION, &expr_grammar_productions[69], 3, sem_expr_lte_gte},
+	{NT_EXPRESSION, &expr_grammar_productions[73], 3, sem_expr_lte_gte},
+	{NT_EXPRESSION, &expr_grammar_productions[77], 3, sem_expr_lte_gte},
+	{NT_EXPRESSION, &expr_grammar_productions[81], 3, sem_expr_lte_gte},
+	{NT_EXPRESSION, &expr_grammar_productions[85], 2, sem_expr_and_or_not},
+	{NT_EXPRESSION, &expr_grammar_productions[88], 3, sem_expr_and_or_not},
+	{NT_EXPRESSION, &expr_grammar_productions[92], 3, sem_expr_and_or_not},
+};
+
+/// Precedence table, PT_SYMBOLS rows (topmost terminal on stack) of PT_SYMBOLS items (token) of pt_item_e,
+/// rows and columns of symbols are expanded from rows of expr_grammar.def
+static const unsigned char expr_grammar_precedence_table[PT_SYMBOLS * PT_SYMBOLS] = {
+	// TOKEN_EQUAL: PT_INDEX_EQUAL
+	108, 105, 105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_DIVR: PT_INDEX_DIVR
+	107, 107, 107, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_DIVI: PT_INDEX_DIVI
+	107, 105, 107, 105, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_MUL: PT_INDEX_MUL
+	107, 107, 107, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_ADD: PT_INDEX_ADD
+	107, 105, 105, 105, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_SUB: PT_INDEX_SUB
+	107, 105, 105, 105, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_UNARY_MINUS: PT_INDEX_UNARY_MINUS
+	107, 107, 107, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_LT: PT_INDEX_LT
+	108, 105, 105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_GT: PT_INDEX_GT
+	108, 105, 105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_LE: PT_INDEX_LE
+	108, 105, 105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_GE: PT_INDEX_GE
+	108, 105, 105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_NE: PT_INDEX_NE
+	108, 105, 105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_COMMA: PT_INDEX_COMMA
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 107, 108, 105, 107, 108, 105, 105, 105,
+	105, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	105, 108, 108, 108, 108, 105, 108, 108, 105, 105, 108, 108, 105, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// TOKEN_LPAR: PT_INDEX_LPAR
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 105, 106, 108, 105, 105, 105,
+	105, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	105, 108, 108, 108, 108, 105, 108, 108, 105, 105, 108, 108, 105, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108,
+	// TOKEN_RPAR: PT_INDEX_RPAR
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// TOKEN_IDENTIFIER: PT_INDEX_ID
+	107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107, 106, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 108, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_STRING: PT_INDEX_CONST
+	107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 108, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_INT: PT_INDEX_CONST
+	107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 108, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_REAL: PT_INDEX_CONST
+	107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 108, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// TOKEN_KW_AND: PT_INDEX_AND
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// TOKEN_KW_FALSE: PT_INDEX_CONST
+	107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 108, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// TOKEN_KW_NOT: PT_INDEX_NOT
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// TOKEN_KW_OR: PT_INDEX_OR
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 107, 107, 105, 107, 107, 105, 105, 105,
+	105, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	105, 107, 107, 107, 107, 105, 107, 107, 105, 107, 107, 107, 105, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// TOKEN_KW_TRUE: PT_INDEX_CONST
+	107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 108, 108, 108,
+	108, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 108, 107, 107, 108, 107, 107, 107, 108, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+	// other: PT_INDEX_END_MARKER
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 108, 109, 105, 108, 109, 105, 105, 105,
+	105, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	105, 109, 109, 109, 109, 105, 109, 109, 105, 105, 109, 109, 105, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109,
+};
+
+/// Trie of rule productions read from the top of the stack, rows of EXPR_TRIE_COLUMNS child nodes
+/// indexed by symbol - NT_EXPRESSION (0 if there is no child)
+static const unsigned char expr_grammar_reduction_trie[48 * EXPR_TRIE_COLUMNS] = {
+	// 0
+	10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 14, 15, 16, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 1
+	4, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 2
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 3
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 4
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 5
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 6
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 7
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 8
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 9
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 10
+	0, 0, 0, 0, 31, 29, 27, 25, 21, 23, 20, 39, 35, 41, 37, 33, 11, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 43, 46, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 11
+	13, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 12
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 13
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 14
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 15
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 16
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 17
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 18
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 19
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 20
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 21
+	22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 22
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 23
+	24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 24
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 25
+	26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 26
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 27
+	28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 28
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 29
+	30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 30
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 31
+	32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 32
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 33
+	34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 34
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 35
+	36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 36
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 37
+	38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 38
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 39
+	40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 40
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 41
+	42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 42
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 43
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 44
+	45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 45
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 46
+	47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+	// 47
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/// Rule reduced when trie node is reached after the whole handle, EXPR_TRIE_NO_RULE if there is none
+static const unsigned char expr_grammar_trie_rules[48] = {
+	27, 27, 27, 0, 27, 11, 1, 27, 27, 2, 27, 27, 3, 4, 5, 6, 7, 8, 9, 10,
+	12, 27, 13, 27, 14, 27, 15, 27, 16, 27, 17, 27, 18, 27, 19, 27, 20, 27, 21, 27,
+	22, 27, 23, 24, 27, 25, 27, 26,
+};
+
+#endif //IFJ17_COMPILER_EXPR_GRAMMAR_TABLES_H
@@ -15,7 +15,7 @@
 #include "ext_stack.h"
 #include "error_code.h"
 
-#define GET_ACTION(s, token) (expr_grammar.precedence_table[pt_map_token(ext_stack_top(s))][pt_map_token(token)])
+#define GET_ACTION(s, token) PT_GET(ext_stack_top(s), token)
 
 int parse_expression(Parser *parser) {
 	assert(parser != NULL);
@@ -27,9 +27,7 @@ int parse_expression(Parser *parser) {
 	token_e last_token = END_OF_TERMINALS;
 
 	do {
-		token_free(token);
-
-		token = scanner_get_token(parser->scanner);
+		token = parser_token(parser);
 		if (token->id == LEX_ERROR) {
 			ret_code = EXIT_LEX_ERROR;
 			break;
@@ -76,9 +74,11 @@ int parse_expression(Parser *parser) {
 
 		if (action == EXPR_PUSH_MARKER) {
 			ext_stack_push(s, token->id, token);
+			parser_next_token(parser);
 		}
 		else if (action == EXPR_HANDLE_MARKER) {
 			ext_stack_shift(s, token);
+			parser_next_token(parser);
 		}
 		else if (action == EXPR_ERROR) {
 			ret_code = EXIT_SYNTAX_ERROR;
@@ -93,7 +93,7 @@ int parse_expression(Parser *parser) {
 
 	if (ret_code == EXIT_SUCCESS) {
 		// After expression evaluation prepare value for parent SemAnalyzer
-		SemAnalyzer* sem_an = (SemAnalyzer*) sem_stack_top(parser->sem_an_stack);
+		SemAnalyzer* sem_an = sem_stack_top(parser->sem_an_stack);
 
 		if (sem_an != NULL) {
 			// Reuse the SemAnalyzer and call sem_expr_result
@@ -105,9 +105,7 @@ int parse_expression(Parser *parser) {
 		}
 	}
 
-	// Return token that is not part of expression
-	scanner_unget_token(parser->scanner, token);
-
+	// Token that is not part of expression stays in scanner
 	ext_stack_free(s);
 
 	return ret_code;
@@ -16,8 +16,17 @@
 #include "debug.h"
 #include "memory_manager.h"
 
+/// True if symbol is non terminal of expression grammar
+#define IS_EXPR_NT(type_id) ((type_id) == NT_EXPRESSION || (type_id) == NT_LIST)
+
 ExtStack* ext_stack_init() {
-	ExtStack* s = dllist_init(ext_stack_item_free);
+	ExtStack* s = (ExtStack*) mm_malloc(sizeof(ExtStack));
+	s->items = (stack_item*) mm_malloc(sizeof(stack_item) * EXT_STACK_INIT_SIZE);
+	s->size = 0;
+	s->capacity = EXT_STACK_INIT_SIZE;
+	s->handles = (unsigned*) mm_malloc(sizeof(unsigned) * EXT_STACK_INIT_SIZE);
+	s->handles_size = 0;
+	s->handles_capacity = EXT_STACK_INIT_SIZE;
 
 	// Right after init push '$' on the stack
 	ext_stack_push(s, EXPR_END_MARKER, NULL);
@@ -25,105 +34,85 @@ ExtStack* ext_stack_init() {
 }
 
 bool ext_stack_expr_on_top(ExtStack *s) {
-	dllist_activate_first(s);
-	stack_item* item = (stack_item*) dllist_get_active(s);
-	if (item->type_id == NT_EXPRESSION)
-		return true;
-	return false;
+	return s->items[s->size - 1].type_id == NT_EXPRESSION;
 }
 
 unsigned ext_stack_top(ExtStack* s) {
-	dllist_activate_first(s);	
-	stack_item* item = (stack_item*) dllist_get_active(s);
-	// item cannot be null - stack is never empty
-
-	// true if current item is non_terminal
-	while (item->type_id == NT_EXPRESSION || item->type_id == NT_LIST) {
-		// There is always at least one TERMINAL on the stack
-		dllist_succ(s);
-		item = (stack_item*) dllist_get_active(s);
-	}
-
-	return item->type_id;
+	// stack is never empty
+	return s->items[s->size - 1].top_terminal;
 }
 
 void ext_stack_shift(ExtStack* s, Token* token) {
 	assert(token != NULL);
-	dllist_activate_first(s);	
-	stack_item* item = (stack_item*) dllist_get_active(s);
 
-	while (item->type_id == NT_EXPRESSION || item->type_id == NT_LIST) {
-		dllist_succ(s);
-		item = (stack_item*) dllist_get_active(s);
+	// Find topmost terminal, non terminals above it become part of the handle
+	unsigned handle = s->size;
+	while (IS_EXPR_NT(s->items[handle - 1].type_id)) {
+		// There is always at least one TERMINAL on the stack
+		handle--;
+		s->items[handle].top_terminal = EXPR_HANDLE_MARKER;
 	}
 
-	// allocate memory for handle marker
-	stack_item* handle_marker = (stack_item *) mm_malloc(sizeof(stack_item));
-	handle_marker->type_id = EXPR_HANDLE_MARKER;
-	handle_marker->token = NULL;
-
-	// insert handle marker right after topmost terminal found in the previous loop
-	dllist_pre_insert(s, handle_marker);
-
-	// Allocate memory for token
-	stack_item* token_ptr = (stack_item*) mm_malloc(sizeof(stack_item));
-	token_ptr->type_id = token->id;
-	token_ptr->token = token_copy(token);
+	// Insert handle marker right after topmost terminal
+	if (s->handles_size == s->handles_capacity) {
+		s->handles_capacity *= 2;
+		s->handles = (unsigned*) mm_realloc(s->handles, sizeof(unsigned) * s->handles_capacity);
+	}
+	s->handles[s->handles_size++] = handle;
 
-	// finally insert token on the top of the stack (top == FIRST)
-	dllist_insert_first(s, token_ptr);
+	// finally push token on the top of the stack
+	ext_stack_push(s, token->id, token);
 }
 
 /**
- * Find rule whose RHS can be found on stack between the top and EXPR_HANDLE_MARKER
+ * Find rule whose RHS can be found on stack between the top and topmost handle marker,
+ * handle is matched by walking the reduction trie from the top of the stack
  * @param s Stack to work with
- * @return LHS(non_terminal) of a rule on success, else EXPR_ERROR
+ * @return rule on success, else NULL
  */
-static Rule* find_rule(ExtStack* s) {
-	dllist_activate_first(s);
-
-	stack_item* item;
-	for (int i = 0; i < NUM_OF_EXPR_RULES; i++) {
-		int k;
-		for (k = 0; expr_grammar.rules[i]->production[k] != END_OF_RULE; k++) {
-			item = (stack_item*) dllist_get_active(s);
-			if(item->type_id != expr_grammar.rules[i]->production[k])
-				break;
-
-			dllist_succ(s);
-		}
-
-		item = (stack_item*) dllist_get_active(s);
-		if (item->type_id == EXPR_HANDLE_MARKER && expr_grammar.rules[i]->production[k] == END_OF_RULE)
-			return expr_grammar.rules[i];	// rule FOUND
-
-		dllist_activate_first(s);
+static const Rule* find_rule(ExtStack* s) {
+	if (s->handles_size == 0)
+		return NULL;
+
+	unsigned handle = s->handles[s->handles_size - 1];
+	unsigned node = 0;
+	for (unsigned item = s->size; item > handle; item--) {
+		assert(s->items[item - 1].type_id >= NT_EXPRESSION);
+		node = EXPR_TRIE_NEXT(node, s->items[item - 1].type_id);
+		if (node == 0)
+			return NULL;
 	}
 
-	return NULL;
+	unsigned rule = expr_grammar.trie_rules[node];
+	if (rule == EXPR_TRIE_NO_RULE)
+		return NULL;
+	return &expr_grammar.rules[rule];	// rule FOUND
 }
 
 int ext_stack_reduce(ExtStack* s, Parser* parser) {
-	Rule* rule = find_rule(s);
+	const Rule* rule = find_rule(s);
 	if (rule == NULL)
 		return EXIT_SYNTAX_ERROR;
 	else {
-		// Init semantic analyzer for rule
+		// Init semantic analyzer for rule, it is pushed on stack after its children are popped
+		SemAnalyzer sem_an_storage;
 		SemAnalyzer* sem_an = NULL;
 		SemAnalyzer* sem_an_top = NULL;
 
 		if (rule->sem_action != NULL) {
-			sem_an = sem_an_init(rule->sem_action);
+			sem_an = &sem_an_storage;
+			sem_an_init(sem_an, rule->sem_action);
 		}
 
 		int ret_val = EXIT_SUCCESS;
-		stack_item* item = (stack_item*) dllist_delete_first(s);
-		while (item->type_id != EXPR_HANDLE_MARKER && ret_val == EXIT_SUCCESS) {
+		unsigned handle = s->handles[--s->handles_size];
+		while (s->size > handle && ret_val == EXIT_SUCCESS) {
+			stack_item* item = &s->items[--s->size];
 			if (sem_an != NULL) {  // Handle semantics
 				if (IS_TOKEN(item->type_id)) {
-					ret_val = sem_an->sem_action(sem_an, parser, SEM_VALUE_TOKEN(item->token));
+					ret_val = sem_an->sem_action(sem_an, parser, SEM_VALUE_TOKEN(&item->token));
 				} else if (IS_NONTERMINAL(item->type_id)){
-					sem_an_top = (SemAnalyzer*) sem_stack_pop(parser->sem_an_stack);
+					sem_an_top = sem_stack_pop(parser->sem_an_stack);
 					assert(sem_an_top != NULL);
 
 					// Pass value to current semantic action
@@ -131,11 +120,9 @@ int ext_stack_reduce(ExtStack* s, Parser* parser) {
 					sem_an_free(sem_an_top);
 				}
 			}
-			ext_stack_item_free(item);
-			item = (stack_item*) dllist_delete_first(s);
 		}
-		// Free also item containing handle marker
-		ext_stack_item_free(item);
+		// Remove also the rest of the handle
+		s->size = handle;
 
 		if (ret_val != EXIT_SUCCESS)
 			return ret_val;
@@ -152,31 +139,41 @@ int ext_stack_reduce(ExtStack* s, Parser* parser) {
 }
 
 void ext_stack_push(ExtStack* s, unsigned type_id, Token* token) {
-	stack_item* item = (stack_item*) mm_malloc(sizeof(stack_item));
-	item->type_id = type_id;
-	item->token = token_copy(token);
+	if (s->size == s->capacity) {
+		s->capacity *= 2;
+		s->items = (stack_item*) mm_realloc(s->items, sizeof(stack_item) * s->capacity);
+	}
 
-	// Top of the stack is the first item in the list
-	dllist_insert_first(s, item);
-}
+	stack_item* item = &s->items[s->size];
+	item->type_id = type_id;
+	if (IS_EXPR_NT(type_id))
+		item->top_terminal = s->items[s->size - 1].top_terminal;  // There is always a terminal below
+	else
+		item->top_terminal = type_id;
+
+	if (token != NULL) {
+		item->token = *token;
+	} else {
+		item->token.id = END_OF_TERMINALS;
+		item->token.borrowed = true;
+		item->token.data.str = NULL;
+	}
 
-void ext_stack_item_free(void* item) {
-	token_free(((stack_item*) item)->token);
-	mm_free(item);
+	s->size++;
 }
 
 void ext_stack_free(ExtStack* s) {
-	dllist_free(s);
+	mm_free(s->handles);
+	mm_free(s->items);
+	mm_free(s);
 }
 
-void stack_item_debug(void* item) {
-	stack_item* sitem = (stack_item*) item;
-
-	debug("stack_item@%p: {", sitem);
+void stack_item_debug(stack_item* item) {
+	debug("stack_item@%p: {", item);
 
-	if (sitem != NULL) {
-		debug(".type_id = %d, .token = ", sitem->type_id);
-		token_debug(sitem->token);
+	if (item != NULL) {
+		debug(".type_id = %d, .token = ", item->type_id);
+		token_debug(&item->token);
 	}
 
 	debugs("}");
@@ -188,10 +185,9 @@ void ext_stack_debug(void* s) {
 	debug("ExtStack@%p: From top {\n", stack);
 
 	if (stack != NULL) {
-		dllist_activate_first(stack);
-		while (dllist_active(stack)) {
+		for (unsigned i = stack->size; i > 0; i--) {
 			debugs("\t");
-			stack_item_debug(dllist_get_active(stack));
+			stack_item_debug(&stack->items[i - 1]);
 			debugs("\n");
 		}
 	}
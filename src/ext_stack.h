@@ -13,23 +13,31 @@
 #include <stdbool.h>
 
 #include "token.h"
-#include "dllist.h"
 #include "parser.h"
 
-
-/**
- * Extended stack data type
- */
-typedef DLList ExtStack;
+#define EXT_STACK_INIT_SIZE 32  // Initial number of items and handles, stack grows twice when it is full
 
 /**
  * Extended stack ITEM data type
  */
 typedef struct stack_item_t {
 	unsigned type_id;	/// TOKEN or non_terminal or END_MARKER
-	Token* token;  /// If type_id is token, here is stored Token data for semantic actions
+	unsigned top_terminal;  /// Topmost TERMINAL at or below this item, so top of the stack does not need to be searched
+	Token token;  /// If type_id is token, here is stored Token data for semantic actions (string is not copied)
 } stack_item;
 
+/**
+ * Extended stack data type, array of items with top at the end
+ */
+typedef struct ext_stack_t {
+	stack_item* items;  /// Items of the stack, bottom first
+	unsigned size;  /// Number of items
+	unsigned capacity;  /// Allocated number of items
+	unsigned* handles;  /// Stack of handle markers, index of item right above the marker (first item of handle)
+	unsigned handles_size;  /// Number of handle markers
+	unsigned handles_capacity;  /// Allocated number of handle markers
+} ExtStack;
+
 /**
  * Init extended stack
  */
@@ -40,17 +48,12 @@ ExtStack* ext_stack_init();
  */
 void ext_stack_free(ExtStack* s);
 
-/**
- * Free stack item
- * @param item stack_item
- */
-void ext_stack_item_free(void* item);
-
 /**
  * Push TOKEN or EXPR_END_MARKER on top of the stack
  * @param s stack to work with
  * @param type_id symbol to be pushed
- * @param token if type_id is token, this is the token data, otherwise NULL
+ * @param token if type_id is token, this is the token data, otherwise NULL. Token is stored without
+ *              copying its string, so the string has to outlive the stack (tokens of scanner and token stream do)
  */
 void ext_stack_push(ExtStack* s, unsigned type_id, Token* token);
 
@@ -70,7 +73,7 @@ bool ext_stack_expr_on_top(ExtStack* s);
 
 /**
  * Insert "EXPR_SHIFT" mark right after topmost TERMINAL on stack.
- * Push given token on top of the stack.
+ * Push given token on top of the stack, token is stored as by ext_stack_push.
  * @param s stack to work with
  * @param token token to be inserted on top of the stack
  */
@@ -88,7 +91,7 @@ int ext_stack_reduce(ExtStack* s, Parser* parser);
  * Debug info about stack_item
  * @param item stack_item
  */
-void stack_item_debug(void* item);
+void stack_item_debug(stack_item* item);
 
 /**
  * Debug info about ExtStack
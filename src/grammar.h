@@ -11,12 +11,18 @@
 #define IFJ17_COMPILER_GRAMMAR_H
 
 #include <stdbool.h>
-#include "sparse_table.h"
+#include <stdint.h>
 #include "sem_analyzer.h"
 
-// Number of rules in grammar. Needs to be incremented by 1 because first rule is empty
+// Number of rules in grammar. Needs to be incremented by 1 because first rule is empty, rule index has to fit in LL table item
 #define NUM_OF_RULES 79
 
+/// Number of LL table columns, one for each terminal
+#define LL_TABLE_COLUMNS (END_OF_TERMINALS - TERMINALS_START)
+
+/// Get index to rules from LL table, column has to be less than LL_TABLE_COLUMNS
+#define LL_TABLE_GET(nt, column) (grammar.LL_table[(nt) * LL_TABLE_COLUMNS + (column)])
+
 /// Get number of variable arguments
 #define NUM_ARGS(...)  (sizeof((unsigned[]){__VA_ARGS__})/sizeof(unsigned))
 
@@ -82,32 +88,17 @@ typedef enum {
  */
 typedef struct rule_t {
     non_terminal_e for_nt;  /// To which non terminal this rule applies
-    unsigned* production;  /// Array of non_terminal_e and token_e ending with END_OF_RULE
+    const uint16_t* production;  /// Array of non_terminal_e and token_e ending with END_OF_RULE
+    unsigned length;  /// Number of symbols in production without END_OF_RULE
     semantic_action_f sem_action;  /// Semantic action, NULL if no action
 } Rule;
 
 /**
- * Global grammar. Needs to be initialized.
+ * Global grammar, constant tables generated from grammar.def
  */
-extern struct grammar_t {
-    Rule* rules[NUM_OF_RULES];  /// Array of rules.
-    SparseTable* LL_table;  /// The LL table of the grammar
+extern const struct grammar_t {
+    const Rule* rules;  /// Array of NUM_OF_RULES rules, rule at index 0 is not used
+    const unsigned char* LL_table;  /// The LL table of the grammar, NT_ENUM_SIZE rows of LL_TABLE_COLUMNS indexes to rules (0 if there is no rule)
 } grammar;
 
-/**
- * Initialize grammar
- */
-void grammar_init();
-
-/**
- * Free rule
- * @param rule pointer to rule structure
- */
-void rule_free(Rule* rule);
-
-/**
- * Free grammar
- */
-void grammar_free();
-
 #endif //IFJ17_COMPILER_GRAMMAR_H
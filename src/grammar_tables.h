@@ -0,0 +1,464 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+/*
+ * Rules and LL table of the grammar
+ *
+ * GENERATED by tools/gen_grammar_tables.c from grammar.def, do not edit.
+ */
+
+#ifndef IFJ17_COMPILER_GRAMMAR_TABLES_H
+#define IFJ17_COMPILER_GRAMMAR_TABLES_H
+
+/// Tables are valid only for enums they were generated with
+typedef char grammar_tables_check[NT_ENUM_SIZE == 39 && END_OF_TERMINALS == 102 ? 1 : -1];
+
+/// Productions of rules (in order they are pushed on stack), each ends by END_OF_RULE
+static const uint16_t grammar_productions[] = {
+	// 1: NT_LINE -> NT_GLOBAL_STMT, NT_SCOPE_STMT, NT_LINE_END
+	NT_LINE_END, NT_SCOPE_STMT, NT_GLOBAL_STMT, END_OF_RULE,
+	// 2: NT_LINE_END -> TOKEN_EOL, NT_LINE_END
+	NT_LINE_END, TOKEN_EOL, END_OF_RULE,
+	// 3: NT_LINE_END -> eps
+	END_OF_RULE,
+	// 4: NT_GLOBAL_STMT -> NT_FUNC_DECL, TOKEN_EOL, NT_GLOBAL_STMT
+	NT_GLOBAL_STMT, TOKEN_EOL, NT_FUNC_DECL, END_OF_RULE,
+	// 5: NT_GLOBAL_STMT -> NT_FUNC_DEF, TOKEN_EOL, NT_GLOBAL_STMT
+	NT_GLOBAL_STMT, TOKEN_EOL, NT_FUNC_DEF, END_OF_RULE,
+	// 6: NT_GLOBAL_STMT -> NT_SHARED_VAR, TOKEN_EOL, NT_GLOBAL_STMT
+	NT_GLOBAL_STMT, TOKEN_EOL, NT_SHARED_VAR, END_OF_RULE,
+	// 7: NT_GLOBAL_STMT -> TOKEN_EOL, NT_GLOBAL_STMT
+	NT_GLOBAL_STMT, TOKEN_EOL, END_OF_RULE,
+	// 8: NT_GLOBAL_STMT -> eps
+	END_OF_RULE,
+	// 9: NT_INNER_STMT -> NT_VAR_DECL
+	NT_VAR_DECL, END_OF_RULE,
+	// 10: NT_INNER_STMT -> NT_ASSIGNMENT
+	NT_ASSIGNMENT, END_OF_RULE,
+	// 11: NT_INNER_STMT -> NT_IF_STMT
+	NT_IF_STMT, END_OF_RULE,
+	// 12: NT_INNER_STMT -> NT_SCOPE_STMT
+	NT_SCOPE_STMT, END_OF_RULE,
+	// 13: NT_INNER_STMT -> NT_DO_STMT
+	NT_DO_STMT, END_OF_RULE,
+	// 14: NT_INNER_STMT -> NT_FOR_STMT
+	NT_FOR_STMT, END_OF_RULE,
+	// 15: NT_INNER_STMT -> NT_PRINT_STMT
+	NT_PRINT_STMT, END_OF_RULE,
+	// 16: NT_INNER_STMT -> NT_INPUT_STMT
+	NT_INPUT_STMT, END_OF_RULE,
+	// 17: NT_INNER_STMT -> NT_RETURN_STMT
+	NT_RETURN_STMT, END_OF_RULE,
+	// 18: NT_INNER_STMT -> NT_EXIT_STMT
+	NT_EXIT_STMT, END_OF_RULE,
+	// 19: NT_INNER_STMT -> NT_CONTINUE_STMT
+	NT_CONTINUE_STMT, END_OF_RULE,
+	// 20: NT_INNER_STMT -> eps
+	END_OF_RULE,
+	// 21: NT_STMT_SEQ -> NT_INNER_STMT, TOKEN_EOL, NT_STMT_SEQ
+	NT_STMT_SEQ, TOKEN_EOL, NT_INNER_STMT, END_OF_RULE,
+	// 22: NT_STMT_SEQ -> eps
+	END_OF_RULE,
+	// 23: NT_VAR_DECL -> TOKEN_KW_DIM, NT_VAR_DEF
+	NT_VAR_DEF, TOKEN_KW_DIM, END_OF_RULE,
+	// 24: NT_VAR_DECL -> TOKEN_KW_STATIC, NT_VAR_DEF
+	NT_VAR_DEF, TOKEN_KW_STATIC, END_OF_RULE,
+	// 25: NT_SHARED_VAR -> TOKEN_KW_DIM, TOKEN_KW_SHARED, NT_VAR_DEF
+	NT_VAR_DEF, TOKEN_KW_SHARED, TOKEN_KW_DIM, END_OF_RULE,
+	// 26: NT_VAR_DEF -> TOKEN_IDENTIFIER, TOKEN_KW_AS, NT_TYPE, NT_INIT_OPT
+	NT_INIT_OPT, NT_TYPE, TOKEN_KW_AS, TOKEN_IDENTIFIER, END_OF_RULE,
+	// 27: NT_INIT_OPT -> TOKEN_EQUAL, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_EQUAL, END_OF_RULE,
+	// 28: NT_INIT_OPT -> eps
+	END_OF_RULE,
+	// 29: NT_FUNC_DECL -> TOKEN_KW_DECLARE, TOKEN_KW_FUNCTION, TOKEN_IDENTIFIER, TOKEN_LPAR, NT_PARAMS, TOKEN_RPAR, TOKEN_KW_AS, NT_TYPE
+	NT_TYPE, TOKEN_KW_AS, TOKEN_RPAR, NT_PARAMS, TOKEN_LPAR, TOKEN_IDENTIFIER, TOKEN_KW_FUNCTION, TOKEN_KW_DECLARE, END_OF_RULE,
+	// 30: NT_TYPE -> TOKEN_KW_INTEGER
+	TOKEN_KW_INTEGER, END_OF_RULE,
+	// 31: NT_TYPE -> TOKEN_KW_DOUBLE
+	TOKEN_KW_DOUBLE, END_OF_RULE,
+	// 32: NT_TYPE -> TOKEN_KW_STRING
+	TOKEN_KW_STRING, END_OF_RULE,
+	// 33: NT_TYPE -> TOKEN_KW_BOOLEAN
+	TOKEN_KW_BOOLEAN, END_OF_RULE,
+	// 34: NT_FUNC_DEF -> TOKEN_KW_FUNCTION, TOKEN_IDENTIFIER, TOKEN_LPAR, NT_PARAMS, TOKEN_RPAR, TOKEN_KW_AS, NT_TYPE, TOKEN_EOL, NT_STMT_SEQ, TOKEN_KW_END, TOKEN_KW_FUNCTION
+	TOKEN_KW_FUNCTION, TOKEN_KW_END, NT_STMT_SEQ, TOKEN_EOL, NT_TYPE, TOKEN_KW_AS, TOKEN_RPAR, NT_PARAMS, TOKEN_LPAR, TOKEN_IDENTIFIER, TOKEN_KW_FUNCTION, END_OF_RULE,
+	// 35: NT_PARAM_DECL -> TOKEN_IDENTIFIER, TOKEN_KW_AS, NT_TYPE
+	NT_TYPE, TOKEN_KW_AS, TOKEN_IDENTIFIER, END_OF_RULE,
+	// 36: NT_PARAMS -> NT_PARAM_DECL, NT_PARAMS_NEXT
+	NT_PARAMS_NEXT, NT_PARAM_DECL, END_OF_RULE,
+	// 37: NT_PARAMS -> eps
+	END_OF_RULE,
+	// 38: NT_PARAMS_NEXT -> TOKEN_COMMA, NT_PARAM_DECL, NT_PARAMS_NEXT
+	NT_PARAMS_NEXT, NT_PARAM_DECL, TOKEN_COMMA, END_OF_RULE,
+	// 39: NT_PARAMS_NEXT -> eps
+	END_OF_RULE,
+	// 40: NT_RETURN_STMT -> TOKEN_KW_RETURN, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_KW_RETURN, END_OF_RULE,
+	// 41: NT_ASSIGNMENT -> TOKEN_IDENTIFIER, NT_ASSIGN_OPERATOR, NT_EXPRESSION
+	NT_EXPRESSION, NT_ASSIGN_OPERATOR, TOKEN_IDENTIFIER, END_OF_RULE,
+	// 42: NT_INPUT_STMT -> TOKEN_KW_INPUT, TOKEN_IDENTIFIER
+	TOKEN_IDENTIFIER, TOKEN_KW_INPUT, END_OF_RULE,
+	// 43: NT_PRINT_STMT -> TOKEN_KW_PRINT, NT_EXPRESSION, TOKEN_SEMICOLON, NT_EXPRESSION_LIST
+	NT_EXPRESSION_LIST, TOKEN_SEMICOLON, NT_EXPRESSION, TOKEN_KW_PRINT, END_OF_RULE,
+	// 44: NT_EXPRESSION_LIST -> NT_EXPRESSION, TOKEN_SEMICOLON, NT_EXPRESSION_LIST
+	NT_EXPRESSION_LIST, TOKEN_SEMICOLON, NT_EXPRESSION, END_OF_RULE,
+	// 45: NT_EXPRESSION_LIST -> eps
+	END_OF_RULE,
+	// 46: NT_SCOPE_STMT -> TOKEN_KW_SCOPE, TOKEN_EOL, NT_STMT_SEQ, TOKEN_KW_END, TOKEN_KW_SCOPE
+	TOKEN_KW_SCOPE, TOKEN_KW_END, NT_STMT_SEQ, TOKEN_EOL, TOKEN_KW_SCOPE, END_OF_RULE,
+	// 47: NT_IF_STMT -> TOKEN_KW_IF, NT_EXPRESSION, TOKEN_KW_THEN, TOKEN_EOL, NT_STMT_SEQ, NT_IF_STMT_ELSEIF, NT_IF_STMT_ELSE, TOKEN_KW_END, TOKEN_KW_IF
+	TOKEN_KW_IF, TOKEN_KW_END, NT_IF_STMT_ELSE, NT_IF_STMT_ELSEIF, NT_STMT_SEQ, TOKEN_EOL, TOKEN_KW_THEN, NT_EXPRESSION, TOKEN_KW_IF, END_OF_RULE,
+	// 48: NT_IF_STMT_ELSEIF -> TOKEN_KW_ELSEIF, NT_EXPRESSION, TOKEN_KW_THEN, TOKEN_EOL, NT_STMT_SEQ, NT_IF_STMT_ELSEIF
+	NT_IF_STMT_ELSEIF, NT_STMT_SEQ, TOKEN_EOL, TOKEN_KW_THEN, NT_EXPRESSION, TOKEN_KW_ELSEIF, END_OF_RULE,
+	// 49: NT_IF_STMT_ELSEIF -> eps
+	END_OF_RULE,
+	// 50: NT_IF_STMT_ELSE -> TOKEN_KW_ELSE, TOKEN_EOL, NT_STMT_SEQ
+	NT_STMT_SEQ, TOKEN_EOL, TOKEN_KW_ELSE, END_OF_RULE,
+	// 51: NT_IF_STMT_ELSE -> eps
+	END_OF_RULE,
+	// 52: NT_DO_STMT -> TOKEN_KW_DO, NT_DO_STMT_END
+	NT_DO_STMT_END, TOKEN_KW_DO, END_OF_RULE,
+	// 53: NT_DO_STMT_END -> NT_TEST_TYPE_START, NT_EXPRESSION, TOKEN_EOL, NT_STMT_SEQ, TOKEN_KW_LOOP
+	TOKEN_KW_LOOP, NT_STMT_SEQ, TOKEN_EOL, NT_EXPRESSION, NT_TEST_TYPE_START, END_OF_RULE,
+	// 54: NT_DO_STMT_END -> TOKEN_EOL, NT_STMT_SEQ, TOKEN_KW_LOOP, NT_TEST_TYPE_END
+	NT_TEST_TYPE_END, TOKEN_KW_LOOP, NT_STMT_SEQ, TOKEN_EOL, END_OF_RULE,
+	// 55: NT_TEST_TYPE_START -> TOKEN_KW_WHILE
+	TOKEN_KW_WHILE, END_OF_RULE,
+	// 56: NT_TEST_TYPE_START -> TOKEN_KW_UNTIL
+	TOKEN_KW_UNTIL, END_OF_RULE,
+	// 57: NT_TEST_TYPE_END -> TOKEN_KW_WHILE, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_KW_WHILE, END_OF_RULE,
+	// 58: NT_TEST_TYPE_END -> TOKEN_KW_UNTIL, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_KW_UNTIL, END_OF_RULE,
+	// 59: NT_TEST_TYPE_END -> eps
+	END_OF_RULE,
+	// 60: NT_EXIT_STMT -> TOKEN_KW_EXIT, NT_LOOP_TYPE, NT_LOOP_TYPE_END
+	NT_LOOP_TYPE_END, NT_LOOP_TYPE, TOKEN_KW_EXIT, END_OF_RULE,
+	// 61: NT_CONTINUE_STMT -> TOKEN_KW_CONTINUE, NT_LOOP_TYPE, NT_LOOP_TYPE_END
+	NT_LOOP_TYPE_END, NT_LOOP_TYPE, TOKEN_KW_CONTINUE, END_OF_RULE,
+	// 62: NT_LOOP_TYPE -> TOKEN_KW_DO
+	TOKEN_KW_DO, END_OF_RULE,
+	// 63: NT_LOOP_TYPE -> TOKEN_KW_FOR
+	TOKEN_KW_FOR, END_OF_RULE,
+	// 64: NT_LOOP_TYPE_END -> TOKEN_COMMA, NT_LOOP_TYPE, NT_LOOP_TYPE_END
+	NT_LOOP_TYPE_END, NT_LOOP_TYPE, TOKEN_COMMA, END_OF_RULE,
+	// 65: NT_LOOP_TYPE_END -> eps
+	END_OF_RULE,
+	// 66: NT_FOR_STMT -> TOKEN_KW_FOR, TOKEN_IDENTIFIER, NT_TYPE_OPT, TOKEN_EQUAL, NT_EXPRESSION, TOKEN_KW_TO, NT_EXPRESSION, NT_STEP_OPT, TOKEN_EOL, NT_STMT_SEQ, TOKEN_KW_NEXT, NT_ID_OPT
+	NT_ID_OPT, TOKEN_KW_NEXT, NT_STMT_SEQ, TOKEN_EOL, NT_STEP_OPT, NT_EXPRESSION, TOKEN_KW_TO, NT_EXPRESSION, TOKEN_EQUAL, NT_TYPE_OPT, TOKEN_IDENTIFIER, TOKEN_KW_FOR, END_OF_RULE,
+	// 67: NT_TYPE_OPT -> TOKEN_KW_AS, NT_TYPE
+	NT_TYPE, TOKEN_KW_AS, END_OF_RULE,
+	// 68: NT_TYPE_OPT -> eps
+	END_OF_RULE,
+	// 69: NT_STEP_OPT -> TOKEN_KW_STEP, NT_EXPRESSION
+	NT_EXPRESSION, TOKEN_KW_STEP, END_OF_RULE,
+	// 70: NT_STEP_OPT -> eps
+	END_OF_RULE,
+	// 71: NT_ID_OPT -> TOKEN_IDENTIFIER
+	TOKEN_IDENTIFIER, END_OF_RULE,
+	// 72: NT_ID_OPT -> eps
+	END_OF_RULE,
+	// 73: NT_ASSIGN_OPERATOR -> TOKEN_EQUAL
+	TOKEN_EQUAL, END_OF_RULE,
+	// 74: NT_ASSIGN_OPERATOR -> TOKEN_SUB_ASIGN
+	TOKEN_SUB_ASIGN, END_OF_RULE,
+	// 75: NT_ASSIGN_OPERATOR -> TOKEN_ADD_ASIGN
+	TOKEN_ADD_ASIGN, END_OF_RULE,
+	// 76: NT_ASSIGN_OPERATOR -> TOKEN_MUL_ASIGN
+	TOKEN_MUL_ASIGN, END_OF_RULE,
+	// 77: NT_ASSIGN_OPERATOR -> TOKEN_DIVI_ASIGN
+	TOKEN_DIVI_ASIGN, END_OF_RULE,
+	// 78: NT_ASSIGN_OPERATOR -> TOKEN_DIVR_ASIGN
+	TOKEN_DIVR_ASIGN, END_OF_RULE,
+};
+
+/// Rules of grammar
+static const Rule grammar_rule_table[NUM_OF_RULES] = {
+	{NT_ENUM_SIZE, NULL, 0, NULL},  // No rule
+	{NT_LINE, &grammar_productions[0], 3, NULL},
+	{NT_LINE_END, &grammar_productions[4], 2, NULL},
+	{NT_LINE_END, &grammar_productions[7], 0, NULL},
+	{NT_GLOBAL_STMT, &grammar_productions[8], 3, NULL},
+	{NT_GLOBAL_STMT, &grammar_productions[12], 3, NULL},
+	{NT_GLOBAL_STMT, &grammar_productions[16], 3, NULL},
+	{NT_GLOBAL_STMT, &grammar_productions[20], 2, NULL},
+	{NT_GLOBAL_STMT, &grammar_productions[23], 0, NULL},
+	{NT_INNER_STMT, &grammar_productions[24], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[26], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[28], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[30], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[32], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[34], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[36], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[38], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[40], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[42], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[44], 1, NULL},
+	{NT_INNER_STMT, &grammar_productions[46], 0, NULL},
+	{NT_STMT_SEQ, &grammar_productions[47], 3, NULL},
+	{NT_STMT_SEQ, &grammar_productions[51], 0, NULL},
+	{NT_VAR_DECL, &grammar_productions[52], 2, sem_var_decl},
+	{NT_VAR_DECL, &grammar_productions[55], 2, sem_var_decl},
+	{NT_SHARED_VAR, &grammar_productions[58], 3, sem_var_decl},
+	{NT_VAR_DEF, &grammar_productions[62], 4, NULL},
+	{NT_INIT_OPT, &grammar_productions[67], 2, NULL},
+	{NT_INIT_OPT, &grammar_productions[70], 0, NULL},
+	{NT_FUNC_DECL, &grammar_productions[71], 8, sem_func_decl},
+	{NT_TYPE, &grammar_productions[80], 1, NULL},
+	{NT_TYPE, &grammar_productions[82], 1, NULL},
+	{NT_TYPE, &grammar_productions[84], 1, NULL},
+	{NT_TYPE, &grammar_productions[86], 1, NULL},
+	{NT_FUNC_DEF, &grammar_productions[88], 11, sem_func_def},
+	{NT_PARAM_DECL, &grammar_productions[100], 3, sem_param_decl},
+	{NT_PARAMS, &grammar_productions[104], 2, NULL},
+	{NT_PARAMS, &grammar_productions[107], 0, NULL},
+	{NT_PARAMS_NEXT, &grammar_productions[108], 3, NULL},
+	{NT_PARAMS_NEXT, &grammar_productions[112], 0, NULL},
+	{NT_RETURN_STMT, &grammar_productions[113], 2, sem_return},
+	{NT_ASSIGNMENT, &grammar_productions[116], 3, sem_expr_assign},
+	{NT_INPUT_STMT, &grammar_productions[120], 2, sem_input},
+	{NT_PRINT_STMT, &grammar_productions[123], 4, sem_print},
+	{NT_EXPRESSION_LIST, &grammar_productions[128], 3, NULL},
+	{NT_EXPRESSION_LIST, &grammar_productions[132], 0, NULL},
+	{NT_SCOPE_STMT, &grammar_productions[133], 5, sem_scope},
+	{NT_IF_STMT, &grammar_productions[139], 9, sem_condition},
+	{NT_IF_STMT_ELSEIF, &grammar_productions[149], 6, NULL},
+	{NT_IF_STMT_ELSEIF, &grammar_productions[156], 0, NULL},
+	{NT_IF_STMT_ELSE, &grammar_productions[157], 3, NULL},
+	{NT_IF_STMT_ELSE, &grammar_productions[161], 0, NULL},
+	{NT_DO_STMT, &grammar_productions[162], 2, sem_do_loop},
+	{NT_DO_STMT_END, &grammar_productions[165], 5, NULL},
+	{NT_DO_STMT_END, &grammar_productions[171], 4, NULL},
+	{NT_TEST_TYPE_START, &grammar_productions[176], 1, NULL},
+	{NT_TEST_TYPE_START, &grammar_productions[178], 1, NULL},
+	{NT_TEST_TYPE_END, &grammar_productions[180], 2, NULL},
+	{NT_TEST_TYPE_END, &grammar_productions[183], 2, NULL},
+	{NT_TEST_TYPE_END, &grammar_productions[186], 0, NULL},
+	{NT_EXIT_STMT, &grammar_productions[187], 3, sem_exit},
+	{NT_CONTINUE_STMT, &grammar_productions[191], 3, sem_continue},
+	{NT_LOOP_TYPE, &grammar_productions[195], 1, NULL},
+	{NT_LOOP_TYPE, &grammar_productions[197], 1, NULL},
+	{NT_LOOP_TYPE_END, &grammar_productions[199], 3, NULL},
+	{NT_LOOP_TYPE_END, &grammar_productions[203], 0, NULL},
+	{NT_FOR_STMT, &grammar_productions[204], 12, sem_for_loop},
+	{NT_TYPE_OPT, &grammar_productions[217], 2, NULL},
+	{NT_TYPE_OPT, &grammar_productions[220], 0, NULL},
+	{NT_STEP_OPT, &grammar_productions[221], 2, NULL},
+	{NT_STEP_OPT, &grammar_productions[224], 0, NULL},
+	{NT_ID_OPT, &grammar_productions[225], 1, NULL},
+	{NT_ID_OPT, &grammar_productions[227], 0, NULL},
+	{NT_ASSIGN_OPERATOR, &grammar_productions[228], 1, NULL},
+	{NT_ASSIGN_OPERATOR, &grammar_productions[230], 1, NULL},
+	{NT_ASSIGN_OPERATOR, &grammar_productions[232], 1, NULL},
+	{NT_ASSIGN_OPERATOR, &grammar_productions[234], 1, NULL},
+	{NT_ASSIGN_OPERATOR, &grammar_productions[236], 1, NULL},
+	{NT_ASSIGN_OPERATOR, &grammar_productions[238], 1, NULL},
+};
+
+/// LL table, NT_ENUM_SIZE rows of LL_TABLE_COLUMNS indexes to rules (0 if there is no rule)
+static const unsigned char grammar_ll_table[NT_ENUM_SIZE * LL_TABLE_COLUMNS] = {
+	// NT_LINE
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_LINE_END
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3,
+	// NT_GLOBAL_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+	0, 0, 4, 6, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_INNER_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 10, 0, 0,
+	0, 0, 0, 9, 13, 0, 0, 0, 0, 11, 16, 0, 0, 15, 17, 12, 0, 0, 0, 0,
+	0, 0, 19, 0, 18, 0, 14, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_STMT_SEQ
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 0, 0,
+	0, 0, 0, 21, 21, 0, 22, 22, 0, 21, 21, 0, 22, 21, 21, 21, 0, 0, 0, 0,
+	0, 0, 21, 22, 21, 0, 21, 22, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_VAR_DECL
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_SHARED_VAR
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_VAR_DEF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_INIT_OPT
+	27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_FUNC_DECL
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_TYPE
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 32, 0, 0, 0,
+	0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_FUNC_DEF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_PARAM_DECL
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_PARAMS
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 36, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_PARAMS_NEXT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 39, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_RETURN_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_ASSIGNMENT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_INPUT_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_PRINT_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_EXPRESSION_LIST
+	0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 44, 44, 44,
+	44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_SCOPE_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_IF_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_IF_STMT_ELSEIF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_IF_STMT_ELSE
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 50, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_DO_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_DO_STMT_END
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_TEST_TYPE_START
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 56,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_TEST_TYPE_END
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 58,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_EXIT_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_CONTINUE_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_LOOP_TYPE
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_LOOP_TYPE_END
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 65, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_FOR_STMT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_TYPE_OPT
+	68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_STEP_OPT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0,
+	0,
+	// NT_ID_OPT
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 71, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_ASSIGN_OPERATOR
+	73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 78, 77, 76, 75,
+	0,
+	// NT_EXPRESSION
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+	// NT_LIST
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0,
+};
+
+#endif //IFJ17_COMPILER_GRAMMAR_TABLES_H
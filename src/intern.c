@@ -0,0 +1,199 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "intern.h"
+#include "memory_manager.h"
+
+/**
+ * Header stored right in front of atom characters
+ */
+typedef struct {
+	unsigned long hash;  /// Hash of atom
+	size_t len;  /// Length of atom
+} AtomHeader;
+
+#define ATOM_HEADER(atom) (((const AtomHeader*) (atom)) - 1)
+
+/**
+ * Table of interned strings
+ */
+static struct {
+	const char** atoms;  /// Open addressing table of atoms (NULL is empty slot)
+	size_t size;  /// Size of table (power of two)
+	size_t count;  /// Number of atoms in table
+	MemArena* arena;  /// Memory for atoms
+	bool initialized;  /// Table is allocated
+} interner;
+
+/**
+ * Forget interned strings, their memory is freed by memory manager
+ */
+static void intern_reset() {
+	interner.initialized = false;
+}
+
+/**
+ * Allocate table of interned strings
+ */
+static void intern_init() {
+	interner.size = INTERN_INIT_SIZE;
+	interner.count = 0;
+	interner.atoms = (const char**) mm_malloc(sizeof(const char*) * interner.size);
+	memset(interner.atoms, 0, sizeof(const char*) * interner.size);
+	interner.arena = mm_arena_create(INTERN_ARENA_CHUNK_SIZE);
+	interner.initialized = true;
+
+	mem_manager_on_free(intern_reset);
+}
+
+/**
+ * Double size of the table of interned strings
+ */
+static void intern_grow() {
+	size_t old_size = interner.size;
+	const char** old_atoms = interner.atoms;
+
+	interner.size *= 2;
+	interner.atoms = (const char**) mm_malloc(sizeof(const char*) * interner.size);
+	memset(interner.atoms, 0, sizeof(const char*) * interner.size);
+
+	for (size_t i = 0; i < old_size; i++) {
+		if (old_atoms[i] == NULL)
+			continue;
+
+		size_t index = ATOM_HEADER(old_atoms[i])->hash & (interner.size - 1);
+		while (interner.atoms[index] != NULL)
+			index = (index + 1) & (interner.size - 1);
+		interner.atoms[index] = old_atoms[i];
+	}
+
+	mm_free(old_atoms);
+}
+
+/**
+ * Find slot of given characters in the table
+ * @param str characters
+ * @param len number of characters
+ * @param hash hash of characters
+ * @return pointer to slot with equal atom or to empty slot
+ */
+static const char** intern_slot(const char* str, size_t len, unsigned long hash) {
+	size_t index = hash & (interner.size - 1);
+
+	while (interner.atoms[index] != NULL) {
+		const char* atom = interner.atoms[index];
+		const AtomHeader* header = ATOM_HEADER(atom);
+		if (header->hash == hash && header->len == len && memcmp(atom, str, len) == 0)
+			break;
+		index = (index + 1) & (interner.size - 1);
+	}
+
+	return &interner.atoms[index];
+}
+
+unsigned long intern_hash_n(unsigned long hash, const char* str, size_t len) {
+	for (size_t i = 0; i < len; i++)
+		hash = ((hash << 5) + hash) + str[i];
+
+	return hash;
+}
+
+const char* intern_n(const char* str, size_t len) {
+	assert(str != NULL);
+	if (!interner.initialized)
+		intern_init();
+
+	unsigned long hash = intern_hash_n(INTERN_HASH_INIT, str, len);
+	const char** slot = intern_slot(str, len, hash);
+	if (*slot != NULL)
+		return *slot;
+
+	AtomHeader* header = (AtomHeader*) mm_arena_alloc(interner.arena, sizeof(AtomHeader) + len + 1);
+	header->hash = hash;
+	header->len = len;
+	char* atom = (char*) (header + 1);
+	memcpy(atom, str, len);
+	atom[len] = '\0';
+
+	*slot = atom;
+	interner.count++;
+	// Keep load factor under 1/2
+	if (interner.count * 2 > interner.size)
+		intern_grow();
+
+	return atom;
+}
+
+const char* intern(const char* str) {
+	assert(str != NULL);
+	return intern_n(str, strlen(str));
+}
+
+const char* intern_find(const char* str) {
+	assert(str != NULL);
+	if (!interner.initialized)
+		return NULL;
+
+	size_t len = strlen(str);
+	return *intern_slot(str, len, intern_hash_n(INTERN_HASH_INIT, str, len));
+}
+
+/**
+ * Compare atom with concatenation of strings
+ * @param atom Interned string
+ * @param parts strings to concatenate
+ * @param count number of strings
+ * @return true if atom is equal to the concatenation
+ */
+static bool intern_equals_parts(const char* atom, const char* const* parts, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		for (const char* ch = parts[i]; *ch != '\0'; ch++, atom++) {
+			if (*atom != *ch)
+				return false;
+		}
+	}
+
+	return *atom == '\0';
+}
+
+const char* intern_find_parts(const char* const* parts, size_t count) {
+	assert(parts != NULL);
+	if (!interner.initialized)
+		return NULL;
+
+	size_t len = 0;
+	unsigned long hash = INTERN_HASH_INIT;
+	for (size_t i = 0; i < count; i++) {
+		size_t part_len = strlen(parts[i]);
+		len += part_len;
+		hash = intern_hash_n(hash, parts[i], part_len);
+	}
+
+	size_t index = hash & (interner.size - 1);
+	while (interner.atoms[index] != NULL) {
+		const char* atom = interner.atoms[index];
+		const AtomHeader* header = ATOM_HEADER(atom);
+		if (header->hash == hash && header->len == len && intern_equals_parts(atom, parts, count))
+			return atom;
+		index = (index + 1) & (interner.size - 1);
+	}
+
+	return NULL;
+}
+
+unsigned long intern_hash(const char* atom) {
+	return ATOM_HEADER(atom)->hash;
+}
+
+size_t intern_len(const char* atom) {
+	return ATOM_HEADER(atom)->len;
+}
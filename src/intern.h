@@ -0,0 +1,81 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+#ifndef IFJ17_COMPILER_INTERN_H
+#define IFJ17_COMPILER_INTERN_H
+
+#include <stddef.h>
+
+#define INTERN_INIT_SIZE 1024  // Has to be power of two
+#define INTERN_ARENA_CHUNK_SIZE 16384
+
+/*
+ * String interning
+ *
+ * Every distinct string is stored only once, interned strings (atoms)
+ * are equal if and only if their pointers are equal. Atoms live until
+ * memory manager is freed.
+ */
+
+/**
+ * Intern string
+ * @param str string
+ * @return atom equal to str
+ */
+const char* intern(const char* str);
+
+/**
+ * Intern first len characters of string
+ * @param str characters (does not have to be terminated by '\0')
+ * @param len number of characters
+ * @return atom equal to the characters
+ */
+const char* intern_n(const char* str, size_t len);
+
+/**
+ * Find atom equal to given string without interning it
+ * @param str string
+ * @return atom or NULL if string was not interned yet
+ */
+const char* intern_find(const char* str);
+
+/**
+ * Find atom equal to concatenation of given strings without building the concatenation
+ * @param parts strings to concatenate
+ * @param count number of strings
+ * @return atom or NULL if concatenation was not interned yet
+ */
+const char* intern_find_parts(const char* const* parts, size_t count);
+
+/**
+ * Get hash of atom, computed by djb2 when string was interned
+ * @param atom Interned string
+ * @return hash value
+ */
+unsigned long intern_hash(const char* atom);
+
+/**
+ * Get length of atom
+ * @param atom Interned string
+ * @return length of atom
+ */
+size_t intern_len(const char* atom);
+
+/**
+ * Compute hash of characters the same way atoms are hashed
+ * @param hash Hash of preceding characters, INTERN_HASH_INIT for start of string
+ * @param str characters
+ * @param len number of characters
+ * @return hash value
+ */
+unsigned long intern_hash_n(unsigned long hash, const char* str, size_t len);
+
+#define INTERN_HASH_INIT 5381
+
+#endif //IFJ17_COMPILER_INTERN_H
@@ -0,0 +1,129 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+/*
+ * Minimal perfect hash table of keywords
+ *
+ * GENERATED by tools/gen_keyword_table.py from TOKEN_KW_* tokens in token.h, do not edit.
+ */
+
+#ifndef IFJ17_COMPILER_KEYWORD_TABLE_H
+#define IFJ17_COMPILER_KEYWORD_TABLE_H
+
+#include <stddef.h>
+#include "token.h"
+
+#define KEYWORD_COUNT 34
+#define KEYWORD_MIN_LEN 2
+#define KEYWORD_MAX_LEN 8
+
+/**
+ * Keyword table entry
+ */
+typedef struct {
+	const char* name;  /// Keyword in lower case
+	size_t len;  /// Length of keyword
+	token_e id;  /// Token of keyword
+} Keyword;
+
+/// Values of characters used by keyword hash (upper and lower case letters have the same value)
+static const unsigned char keyword_asso_values[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 20, 1, 17, 23, 11, 30, 15, 15, 7, 0, 0, 4, 12, 26, 6,
+	27, 0, 4, 16, 20, 18, 0, 31, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 20, 1, 17, 23, 11, 30, 15, 15, 7, 0, 0, 4, 12, 26, 6,
+	27, 0, 4, 16, 20, 18, 0, 31, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/// Keywords indexed by their hash
+static const Keyword keyword_table[KEYWORD_COUNT] = {
+	{"to", 2, TOKEN_KW_TO},
+	{"if", 2, TOKEN_KW_IF},
+	{"exit", 4, TOKEN_KW_EXIT},
+	{"do", 2, TOKEN_KW_DO},
+	{"and", 3, TOKEN_KW_AND},
+	{"true", 4, TOKEN_KW_TRUE},
+	{"boolean", 7, TOKEN_KW_BOOLEAN},
+	{"loop", 4, TOKEN_KW_LOOP},
+	{"continue", 8, TOKEN_KW_CONTINUE},
+	{"for", 3, TOKEN_KW_FOR},
+	{"integer", 7, TOKEN_KW_INTEGER},
+	{"dim", 3, TOKEN_KW_DIM},
+	{"double", 6, TOKEN_KW_DOUBLE},
+	{"return", 6, TOKEN_KW_RETURN},
+	{"function", 8, TOKEN_KW_FUNCTION},
+	{"scope", 5, TOKEN_KW_SCOPE},
+	{"or", 2, TOKEN_KW_OR},
+	{"elseif", 6, TOKEN_KW_ELSEIF},
+	{"declare", 7, TOKEN_KW_DECLARE},
+	{"until", 5, TOKEN_KW_UNTIL},
+	{"as", 2, TOKEN_KW_AS},
+	{"not", 3, TOKEN_KW_NOT},
+	{"print", 5, TOKEN_KW_PRINT},
+	{"string", 6, TOKEN_KW_STRING},
+	{"input", 5, TOKEN_KW_INPUT},
+	{"static", 6, TOKEN_KW_STATIC},
+	{"shared", 6, TOKEN_KW_SHARED},
+	{"next", 4, TOKEN_KW_NEXT},
+	{"while", 5, TOKEN_KW_WHILE},
+	{"end", 3, TOKEN_KW_END},
+	{"else", 4, TOKEN_KW_ELSE},
+	{"then", 4, TOKEN_KW_THEN},
+	{"false", 5, TOKEN_KW_FALSE},
+	{"step", 4, TOKEN_KW_STEP}
+};
+
+/**
+ * Compute keyword hash of identifier
+ * @param str identifier characters
+ * @param len length of identifier, KEYWORD_MIN_LEN <= len
+ * @return index to keyword table
+ */
+static unsigned keyword_hash(const char* str, size_t len) {
+	return (unsigned) ((len
+			+ keyword_asso_values[(unsigned char) str[0]]
+			+ keyword_asso_values[(unsigned char) str[1]]
+			+ keyword_asso_values[(unsigned char) str[len - 1]]) % KEYWORD_COUNT);
+}
+
+/**
+ * Get token of identifier, case insensitive
+ * @param str identifier characters (letters, digits and '_', does not have to be terminated by '\0')
+ * @param len length of identifier
+ * @return keyword token or TOKEN_IDENTIFIER
+ */
+static token_e keyword_lookup(const char* str, size_t len) {
+	if (len < KEYWORD_MIN_LEN || len > KEYWORD_MAX_LEN)
+		return TOKEN_IDENTIFIER;
+
+	const Keyword* keyword = &keyword_table[keyword_hash(str, len)];
+	if (keyword->len != len)
+		return TOKEN_IDENTIFIER;
+
+	// Setting 0x20 bit converts letters to lower case, digits are unchanged and '_' is never equal to a letter
+	for (size_t i = 0; i < len; i++) {
+		if ((str[i] | 0x20) != keyword->name[i])
+			return TOKEN_IDENTIFIER;
+	}
+
+	return keyword->id;
+}
+
+#endif //IFJ17_COMPILER_KEYWORD_TABLE_H
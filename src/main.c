@@ -8,6 +8,7 @@
  */
 
 #include <stdlib.h>
+#include <unistd.h>
 #include "parser.h"
 #include "error_code.h"
 #include "3ac.h"
@@ -18,6 +19,9 @@ int main(int argc, char* argv[]) {
 	il_init();
 	Scanner* scanner = scanner_init();
 	Parser* parser = parser_init(scanner);
+	parser->batch_lexing = true;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	parser->lexer_threads = cpus > 1 ? (unsigned) cpus : 1;
 
 	FILE* in_file = NULL;
 
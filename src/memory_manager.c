@@ -8,8 +8,11 @@
  */
 
 #include <malloc.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
+#include <pthread.h>
 
 #include "memory_manager.h"
 #include "error_code.h"
@@ -17,7 +20,86 @@
 
 #define MEMORY_CHUNK 100
 
-typedef void* Block;  // Just a little bit of abstraction
+/**
+ * Hidden header placed in front of every block returned by mm_malloc,
+ * remembers index of the block in memory manager registry
+ */
+typedef union {
+	struct {
+		unsigned index;  /// Index of block in mm.memory
+#ifdef MEM_MNG_PROFILE
+		unsigned site;  /// Index of allocation site in profile
+		size_t size;  /// Size of user memory
+#endif
+	} info;
+	long double align;  /// Keep user memory aligned as if it was returned by malloc
+} BlockHeader;
+
+typedef BlockHeader* Block;  // Just a little bit of abstraction
+
+#define BLOCK_HEADER(ptr) (((Block) (ptr)) - 1)
+#define BLOCK_DATA(block) ((void*) ((block) + 1))
+
+/**
+ * Memory arena chunk, arena memory is taken from data
+ */
+typedef struct arena_chunk_t {
+	struct arena_chunk_t* next;  /// Previously filled chunk
+	size_t size;  /// Size of data
+	size_t used;  /// Number of used bytes in data
+	BlockHeader data[];  /// Arena memory
+} ArenaChunk;
+
+struct mem_arena_t {
+	ArenaChunk* chunk;  /// Chunk currently being filled
+	size_t chunk_size;  /// Default size of new chunks
+#ifdef MEM_MNG_PROFILE
+	unsigned site;  /// Allocation site of arena, its chunks are accounted to it
+#endif
+};
+
+/**
+ * Free object in pool, links to next free object
+ */
+typedef struct pool_object_t {
+	struct pool_object_t* next;  /// Next free object
+} PoolObject;
+
+/**
+ * Pool of objects of the same size class
+ */
+typedef struct {
+	PoolObject* free_list;  /// Objects returned to pool
+	char* slab_next;  /// Next never used object in current slab
+	char* slab_end;  /// End of current slab
+	unsigned hits;  /// Allocations served by reused object
+	unsigned misses;  /// Allocations served from slab
+} Pool;
+
+#define POOL_CLASSES (POOL_MAX_SIZE / POOL_GRANULARITY)
+#define POOL_CLASS(size) (((size) + POOL_GRANULARITY - 1) / POOL_GRANULARITY - 1)
+
+static Pool pools[POOL_CLASSES];
+
+#ifdef MEM_MNG_PROFILE
+#define PROFILE_SITES 1024
+#define NO_SITE PROFILE_SITES
+
+/**
+ * Allocation statistics of one call site
+ */
+typedef struct {
+	const char* file;  /// Source file of allocation, NULL if site is not used
+	unsigned line;  /// Line of allocation
+	unsigned count;  /// Number of allocations
+	unsigned reallocs;  /// Number of reallocations of blocks allocated here
+	size_t bytes;  /// Total number of allocated bytes (including growth by reallocation)
+	size_t live;  /// Bytes currently allocated
+	size_t peak;  /// Maximum of live bytes
+} AllocSite;
+
+static AllocSite sites[PROFILE_SITES];
+#endif
 
 /**
  * Memory Manager
@@ -27,17 +109,23 @@ struct {
 	unsigned first_free;  /// Index of first free Block in memory (always last unused Block)
 	unsigned size;  /// Actual allocated size of memory
 	unsigned max_blocks;  /// Max blocks allocated in the lifespan of memory manager
+	void (*on_free[MAX_FREE_CALLBACKS])();  /// Functions to call when memory is released
+	unsigned on_free_count;  /// Number of registered functions
+	bool threaded;  /// Blocks are allocated and freed by more threads, registry has to be locked
 } mm;
 
+static pthread_mutex_t mm_lock = PTHREAD_MUTEX_INITIALIZER;  /// Lock of block registry, used only if mm.threaded
+
+#define MM_LOCK() do { if (mm.threaded) pthread_mutex_lock(&mm_lock); } while (0)
+#define MM_UNLOCK() do { if (mm.threaded) pthread_mutex_unlock(&mm_lock); } while (0)
+
 /**
- * Swap two memory blocks
- * @param item1
- * @param item2
+ * Call and unregister functions registered by mem_manager_on_free
  */
-static void memory_block_swap(Block *item1, Block *item2) {
-	void* ptr = *item1;
-	*item1 = *item2;
-	*item2 = ptr;
+static void call_free_callbacks() {
+	for (unsigned i = 0; i < mm.on_free_count; i++)
+		mm.on_free[i]();
+	mm.on_free_count = 0;
 }
 
 /**
@@ -67,23 +155,139 @@ static Block* get_free_memory_block() {
 }
 
 /**
- * Find memory block with given ptr
+ * Find memory block with given ptr, uses index stored in block header
  * @param ptr Allocated memory
  * @return memory block with given ptr
  */
 static Block* memory_block_find(void *ptr) {
-	for (unsigned i = 0; i < mm.first_free; ++i) {
-		if (mm.memory[i] == ptr)
-			return &mm.memory[i];
-	}
+	Block block = BLOCK_HEADER(ptr);
+
+	if (block->info.index < mm.first_free && mm.memory[block->info.index] == block)
+		return &mm.memory[block->info.index];
 
 	debugs("(Memory Manager) ERROR: Memory was not allocated or was already freed!");
 	exit(EXIT_INTERN_ERROR);
 }
 
+#ifdef MEM_MNG_PROFILE
+/**
+ * Find or create statistics of allocation site
+ * @param file Source file
+ * @param line Source line
+ * @return index of site in sites
+ */
+static unsigned profile_site(const char* file, unsigned line) {
+	unsigned long hash = 5381;
+	for (const char* c = file; *c; c++)
+		hash = ((hash << 5) + hash) + *c;
+	hash = (hash + line * 31) % PROFILE_SITES;
+
+	for (unsigned i = 0; i < PROFILE_SITES; i++) {
+		AllocSite* site = &sites[(hash + i) % PROFILE_SITES];
+		if (site->file == NULL) {
+			site->file = file;
+			site->line = line;
+		}
+		if (site->line == line && strcmp(site->file, file) == 0)
+			return (unsigned) ((hash + i) % PROFILE_SITES);
+	}
+
+	return NO_SITE;
+}
+
+/**
+ * Account change of live bytes of block to its allocation site
+ * @param block Allocated block
+ * @param size New size of block
+ */
+static void profile_resize(Block block, size_t size) {
+	if (block->info.site == NO_SITE)
+		return;
+
+	AllocSite* site = &sites[block->info.site];
+	if (size > block->info.size)
+		site->bytes += size - block->info.size;
+	site->live = site->live + size - block->info.size;
+	if (site->live > site->peak)
+		site->peak = site->live;
+
+	block->info.size = size;
+}
+
+/**
+ * Compare sites by number of allocated bytes, used for sorting profile
+ */
+static int profile_site_cmp(const void* a, const void* b) {
+	const AllocSite* site_a = *(const AllocSite* const*) a;
+	const AllocSite* site_b = *(const AllocSite* const*) b;
+
+	if (site_a->bytes == site_b->bytes)
+		return 0;
+	return site_a->bytes < site_b->bytes ? 1 : -1;
+}
+
+/**
+ * Print allocation profile to stderr
+ */
+static void profile_print() {
+	AllocSite* used[PROFILE_SITES];
+	unsigned used_count = 0;
+
+	for (unsigned i = 0; i < PROFILE_SITES; i++) {
+		if (sites[i].file != NULL)
+			used[used_count++] = &sites[i];
+	}
+	qsort(used, used_count, sizeof(AllocSite*), profile_site_cmp);
+
+	fprintf(stderr, "\n======= Allocation profile =======\n");
+	fprintf(stderr, "%-40s %10s %12s %12s %10s\n", "site", "count", "bytes", "peak live", "reallocs");
+	for (unsigned i = 0; i < used_count; i++) {
+		char site[512];
+		snprintf(site, sizeof(site), "%s:%u", used[i]->file, used[i]->line);
+		fprintf(stderr, "%-40s %10u %12lu %12lu %10u\n", site, used[i]->count,
+				(unsigned long) used[i]->bytes, (unsigned long) used[i]->peak, used[i]->reallocs);
+	}
+	fprintf(stderr, "==================================\n");
+}
+#endif
+
+/**
+ * Allocate new block and register it
+ * @param size Size of user memory
+ * @param site Index of allocation site in profile (unused if profiling is disabled)
+ * @return pointer to user memory
+ */
+static void* block_alloc(size_t size, unsigned site) {
+	Block block = (Block) malloc(sizeof(BlockHeader) + size);
+	if (block == NULL) {
+		mem_manager_free();
+		exit(EXIT_INTERN_ERROR);
+	}
+
+	MM_LOCK();
+	Block* item = get_free_memory_block();
+	*item = block;
+	block->info.index = (unsigned) (item - mm.memory);
+#ifdef MEM_MNG_PROFILE
+	block->info.site = site;
+	block->info.size = 0;
+	if (site != NO_SITE)
+		sites[site].count++;
+	profile_resize(block, size);
+#else
+	(void) site;
+#endif
+	MM_UNLOCK();
+
+	return BLOCK_DATA(block);
+}
+
 // PUBLIC INTERFACE
 
 void mem_manager_init() {
+	// Memory of previous initialization is not valid anymore
+	call_free_callbacks();
+
 	mm.memory = (Block *) malloc(sizeof(Block) * MEMORY_CHUNK);
 	if (mm.memory == NULL)
 		exit(EXIT_INTERN_ERROR);
@@ -91,13 +295,31 @@ void mem_manager_init() {
 	mm.size = MEMORY_CHUNK;
 	mm.first_free = 0;
 	mm.max_blocks = 0;
+	mm.threaded = false;
+
+	// Slabs of previous pools are owned by previous registry
+	memset(pools, 0, sizeof(pools));
+#ifdef MEM_MNG_PROFILE
+	memset(sites, 0, sizeof(sites));
+#endif
 }
 
 void mem_manager_free() {
 	debugs("\n======= Memory Manager =======\n");
 	debug("In use at exit: %d blocks\n", mm.first_free);
 	debug("Max blocks used: %d blocks\n", mm.max_blocks);
+	for (unsigned i = 0; i < POOL_CLASSES; i++) {
+		if (pools[i].hits + pools[i].misses > 0) {
+			debug("Pool %u B: %u hits, %u misses\n",
+				  (unsigned) ((i + 1) * POOL_GRANULARITY), pools[i].hits, pools[i].misses);
+		}
+	}
 	debugs("==============================\n");
+#ifdef MEM_MNG_PROFILE
+	profile_print();
+#endif
+
+	call_free_callbacks();
 
 #ifndef MEM_MNG_NO_FREE
 	for (; mm.first_free > 0; mm.first_free--) {
@@ -108,35 +330,212 @@ void mem_manager_free() {
 	free(mm.memory);
 }
 
-void* mm_malloc(size_t size) {
-	Block* item = get_free_memory_block();
+void mem_manager_set_threaded(bool threaded) {
+	mm.threaded = threaded;
+}
 
-	*item = malloc(size);
-	if (*item == NULL) {
-		mem_manager_free();
-		exit(EXIT_INTERN_ERROR);
-	}
+void mem_manager_on_free(void (*callback)()) {
+	assert(mm.on_free_count < MAX_FREE_CALLBACKS);
+	mm.on_free[mm.on_free_count++] = callback;
+}
 
-	return *item;
+// Names are in parentheses, so they are not expanded by profiling macros
+void* (mm_malloc)(size_t size) {
+#ifdef MEM_MNG_PROFILE
+	return block_alloc(size, NO_SITE);
+#else
+	return block_alloc(size, 0);
+#endif
 }
 
-void* mm_realloc(void* ptr, size_t size) {
+void* (mm_realloc)(void* ptr, size_t size) {
+	MM_LOCK();
 	Block* item = memory_block_find(ptr);
 
-	*item = realloc(ptr, size);
-	if (*item == NULL && size != 0) {
+#ifdef MEM_MNG_PROFILE
+	if ((*item)->info.site != NO_SITE)
+		sites[(*item)->info.site].reallocs++;
+	profile_resize(*item, size);
+#endif
+
+	Block block = (Block) realloc(*item, sizeof(BlockHeader) + size);
+	if (block == NULL) {
+		MM_UNLOCK();
 		mem_manager_free();
 		exit(EXIT_INTERN_ERROR);
 	}
 
-	return *item;
+	*item = block;
+	MM_UNLOCK();
+
+	return BLOCK_DATA(block);
 }
 
-void mm_free(void* ptr) {
+void (mm_free)(void* ptr) {
 	assert(ptr != NULL);
-	Block * item = memory_block_find(ptr);
+	MM_LOCK();
+	Block* item = memory_block_find(ptr);
+#ifdef MEM_MNG_PROFILE
+	profile_resize(*item, 0);
+#endif
 	free(*item);
 
 	mm.first_free--;
-	memory_block_swap(item, &mm.memory[mm.first_free]);
+	if (item != &mm.memory[mm.first_free]) {
+		// Move last block to the freed slot
+		*item = mm.memory[mm.first_free];
+		(*item)->info.index = (unsigned) (item - mm.memory);
+	}
+	MM_UNLOCK();
+}
+
+#ifdef MEM_MNG_PROFILE
+void* mm_profile_malloc(size_t size, const char* file, unsigned line) {
+	MM_LOCK();
+	unsigned site = profile_site(file, line);
+	MM_UNLOCK();
+
+	return block_alloc(size, site);
+}
+
+void* mm_profile_realloc(void* ptr, size_t size, const char* file, unsigned line) {
+	// Reallocation is accounted to the site where block was allocated
+	(void) file;
+	(void) line;
+	return (mm_realloc)(ptr, size);
+}
+
+void mm_profile_free(void* ptr, const char* file, unsigned line) {
+	Block block = BLOCK_HEADER(ptr);
+	MM_LOCK();
+	bool valid = block->info.index < mm.first_free && mm.memory[block->info.index] == block;
+	MM_UNLOCK();
+	if (!valid)
+		fprintf(stderr, "(Memory Manager) ERROR: Invalid free at %s:%u\n", file, line);
+	(mm_free)(ptr);
+}
+#endif
+
+void* (mm_pool_malloc)(size_t size) {
+	assert(size > 0);
+	if (size > POOL_MAX_SIZE)
+		return mm_malloc(size);
+
+	Pool* pool = &pools[POOL_CLASS(size)];
+
+	if (pool->free_list != NULL) {
+		PoolObject* object = pool->free_list;
+		pool->free_list = object->next;
+		pool->hits++;
+		return object;
+	}
+
+	size_t object_size = (POOL_CLASS(size) + 1) * POOL_GRANULARITY;
+	if (pool->slab_next == NULL || pool->slab_end - pool->slab_next < (long) object_size) {
+		// Slab is registered in memory manager, so it is freed by mem_manager_free
+		pool->slab_next = (char*) mm_malloc(POOL_SLAB_SIZE);
+		pool->slab_end = pool->slab_next + POOL_SLAB_SIZE / object_size * object_size;
+	}
+
+	void* ptr = pool->slab_next;
+	pool->slab_next += object_size;
+	pool->misses++;
+
+	return ptr;
+}
+
+void (mm_pool_free)(void* ptr, size_t size) {
+	assert(ptr != NULL);
+	if (size > POOL_MAX_SIZE) {
+		mm_free(ptr);
+		return;
+	}
+
+	Pool* pool = &pools[POOL_CLASS(size)];
+	PoolObject* object = (PoolObject*) ptr;
+
+	object->next = pool->free_list;
+	pool->free_list = object;
+}
+
+/**
+ * Add new chunk to arena
+ * @param arena Memory arena
+ * @param size Minimal size of chunk data
+ */
+static void arena_chunk_add(MemArena* arena, size_t size) {
+	if (size < arena->chunk_size)
+		size = arena->chunk_size;
+
+#ifdef MEM_MNG_PROFILE
+	ArenaChunk* chunk = (ArenaChunk*) block_alloc(sizeof(ArenaChunk) + size, arena->site);
+#else
+	ArenaChunk* chunk = (ArenaChunk*) mm_malloc(sizeof(ArenaChunk) + size);
+#endif
+	chunk->size = size;
+	chunk->used = 0;
+	chunk->next = arena->chunk;
+	arena->chunk = chunk;
+}
+
+MemArena* (mm_arena_create)(size_t chunk_size) {
+	MemArena* arena = (MemArena*) mm_malloc(sizeof(MemArena));
+	arena->chunk = NULL;
+	arena->chunk_size = chunk_size;
+#ifdef MEM_MNG_PROFILE
+	arena->site = NO_SITE;
+#endif
+
+	return arena;
+}
+
+#ifdef MEM_MNG_PROFILE
+MemArena* mm_profile_arena_create(size_t chunk_size, const char* file, unsigned line) {
+	MemArena* arena = (mm_arena_create)(chunk_size);
+	arena->site = profile_site(file, line);
+
+	return arena;
+}
+#endif
+
+void* mm_arena_alloc(MemArena* arena, size_t size) {
+	assert(arena != NULL);
+
+	// Keep every allocation aligned the same way mm_malloc does
+	size = (size + sizeof(BlockHeader) - 1) / sizeof(BlockHeader) * sizeof(BlockHeader);
+
+	if (arena->chunk == NULL || arena->chunk->size - arena->chunk->used < size)
+		arena_chunk_add(arena, size);
+
+	void* ptr = (char*) arena->chunk->data + arena->chunk->used;
+	arena->chunk->used += size;
+
+	return ptr;
+}
+
+void mm_arena_reset(MemArena* arena) {
+	assert(arena != NULL);
+
+	if (arena->chunk == NULL)
+		return;
+
+	// Keep the last added chunk for next allocations
+	ArenaChunk* chunk = arena->chunk->next;
+	while (chunk != NULL) {
+		ArenaChunk* next = chunk->next;
+		mm_free(chunk);
+		chunk = next;
+	}
+
+	arena->chunk->next = NULL;
+	arena->chunk->used = 0;
+}
+
+void mm_arena_destroy(MemArena* arena) {
+	assert(arena != NULL);
+
+	mm_arena_reset(arena);
+	if (arena->chunk != NULL)
+		mm_free(arena->chunk);
+	mm_free(arena);
 }
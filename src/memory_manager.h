@@ -10,6 +10,21 @@
 #ifndef IFJ17_COMPILER_MEMORY_MANAGER_H
 #define IFJ17_COMPILER_MEMORY_MANAGER_H
 
+#include <stddef.h>
+#include <stdbool.h>
+
+#define ARENA_CHUNK_SIZE 4096
+#define MAX_FREE_CALLBACKS 8
+
+#define POOL_GRANULARITY 8  // Size classes of pools differ by this number of bytes
+#define POOL_MAX_SIZE 64  // Bigger objects are not pooled
+#define POOL_SLAB_SIZE 4096  // Size of memory block pools take new objects from
+
+/**
+ * Memory arena, bump pointer allocator for objects that die together
+ */
+typedef struct mem_arena_t MemArena;
+
 /**
  * Initialize Memory Manager
  */
@@ -20,6 +35,20 @@ void mem_manager_init();
  */
 void mem_manager_free();
 
+/**
+ * Register function called when memory manager releases all memory (by mem_manager_free or
+ * repeated mem_manager_init), modules keeping global state in managed memory use it to reset the state
+ * @param callback Function to call
+ */
+void mem_manager_on_free(void (*callback)());
+
+/**
+ * Enable locking of allocations, so mm_malloc, mm_realloc, mm_free and arenas of other threads can be used
+ * concurrently (pools are not locked), has to be called when no other thread uses memory manager
+ * @param threaded true to lock allocations
+ */
+void mem_manager_set_threaded(bool threaded);
+
 /**
  * Allocate memory of given size
  * @param size Number of bytes to allocate
@@ -41,4 +70,65 @@ void* mm_realloc(void* ptr, size_t size);
  */
 void mm_free(void* ptr);
 
+/**
+ * Allocate small object of given size from pool of objects of the same size class,
+ * freed objects are reused by following allocations
+ * @param size Size of object in bytes
+ * @return pointer to allocated memory (never NULL)
+ */
+void* mm_pool_malloc(size_t size);
+
+/**
+ * Return object allocated by mm_pool_malloc to its pool
+ * @param ptr Pointer to object
+ * @param size Size of object, has to be the same as the one given to mm_pool_malloc
+ */
+void mm_pool_free(void* ptr, size_t size);
+
+/**
+ * Create new memory arena, its chunks are allocated by mm_malloc
+ * @param chunk_size Size of one arena chunk in bytes
+ * @return new arena (never NULL)
+ */
+MemArena* mm_arena_create(size_t chunk_size);
+
+/**
+ * Allocate memory of given size from arena, memory can not be freed separately
+ * @param arena Memory arena
+ * @param size Number of bytes to allocate
+ * @return pointer to allocated memory (never NULL)
+ */
+void* mm_arena_alloc(MemArena* arena, size_t size);
+
+/**
+ * Release all memory allocated from arena at once, arena can be used again
+ * @param arena Memory arena
+ */
+void mm_arena_reset(MemArena* arena);
+
+/**
+ * Free arena and all memory allocated from it
+ * @param arena Memory arena
+ */
+void mm_arena_destroy(MemArena* arena);
+
+#ifdef MEM_MNG_PROFILE
+// Allocation profiling, every allocation is accounted to the file and line it was made at,
+// profile is printed to stderr by mem_manager_free
+
+void* mm_profile_malloc(size_t size, const char* file, unsigned line);
+void* mm_profile_realloc(void* ptr, size_t size, const char* file, unsigned line);
+void mm_profile_free(void* ptr, const char* file, unsigned line);
+MemArena* mm_profile_arena_create(size_t chunk_size, const char* file, unsigned line);
+
+#define mm_malloc(size) mm_profile_malloc((size), __FILE__, __LINE__)
+#define mm_realloc(ptr, size) mm_profile_realloc((ptr), (size), __FILE__, __LINE__)
+#define mm_free(ptr) mm_profile_free((ptr), __FILE__, __LINE__)
+// Chunks of arena are accounted to the site arena was created at
+#define mm_arena_create(chunk_size) mm_profile_arena_create((chunk_size), __FILE__, __LINE__)
+// Pools would hide allocation sites of pooled objects, so they are bypassed
+#define mm_pool_malloc(size) mm_malloc(size)
+#define mm_pool_free(ptr, size) ((void) (size), mm_free(ptr))
+#endif
+
 #endif //IFJ17_COMPILER_MEMORY_MANAGER_H
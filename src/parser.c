@@ -196,16 +196,20 @@ static void add_built_ins(HashTable* htab) {
 Parser* parser_init(Scanner* scanner) {
 	Parser* parser = (Parser*) mm_malloc(sizeof(Parser));
 	parser->scanner = scanner;
-	grammar_init();
-	expr_grammar_init();
-	parser->dtree_stack = stack_init(30);
+	parser->dtree_stack = symbol_stack_init(DTREE_STACK_INIT_SIZE);
+	parser->sym_tab_arena = mm_arena_create(SYM_TAB_ARENA_CHUNK_SIZE);
 	parser->sym_tab_stack = dllist_init(htab_var_free);
-	parser->sym_tab_global = htab_init(HTAB_INIT_SIZE);
-	parser->sym_tab_functions = htab_init(HTAB_INIT_SIZE);
+	parser->sym_tab_global = htab_init_arena(HTAB_INIT_SIZE, parser->sym_tab_arena);
+	parser->sym_tab_functions = htab_init_arena(HTAB_INIT_SIZE, parser->sym_tab_arena);
 	add_built_ins(parser->sym_tab_functions);
 
 
-	parser->sem_an_stack = dllist_init(sem_an_free);
+	parser->sem_an_stack = sem_stack_init();
+
+	parser->batch_lexing = false;
+	parser->lexer_threads = 1;
+	parser->tokens = NULL;
+	parser->token_index = 0;
 
 	parser->il_override = NULL;
 	parser->static_var_decl = false;
@@ -219,11 +223,12 @@ void parser_free(Parser* parser) {
 
 	htab_var_free(parser->sym_tab_global);
 	dllist_free(parser->sym_tab_stack);
-	dllist_free(parser->sem_an_stack);
+	sem_stack_free(parser->sem_an_stack);
 	htab_func_free(parser->sym_tab_functions);
-	grammar_free();
-	expr_grammar_free();
-	stack_free(parser->dtree_stack, NULL);
+	mm_arena_destroy(parser->sym_tab_arena);
+	symbol_stack_free(parser->dtree_stack);
+	if (parser->tokens != NULL)
+		token_stream_free(parser->tokens);
 	mm_free(parser);
 }
 
@@ -236,16 +241,15 @@ static int handle_finished_semantics(Parser* parser) {
 	SemAnalyzer* sem_an_to_free;
 	int ret_code = EXIT_SUCCESS;
 
-	SemAnalyzer* sem_an = (SemAnalyzer *) sem_stack_top(parser->sem_an_stack);
+	SemAnalyzer* sem_an = sem_stack_top(parser->sem_an_stack);
 
 	// Finish up semantic analyzers
 	while (sem_an != NULL && sem_an->finished && (ret_code == EXIT_SUCCESS)) {
-		// If semantic action is finished, pop it from stack
-		sem_stack_pop(parser->sem_an_stack);
-		sem_an_to_free = sem_an;  // Store it for later freeing
+		// If semantic action is finished, pop it from stack, it stays valid until next push
+		sem_an_to_free = sem_stack_pop(parser->sem_an_stack);  // Store it for later freeing
 
 		// Get parent semantic action
-		sem_an = (SemAnalyzer *) sem_stack_top(parser->sem_an_stack);
+		sem_an = sem_stack_top(parser->sem_an_stack);
 		if (sem_an != NULL && sem_an_to_free->value != NULL) {
 			// Call parent semantic action with value from child
 			ret_code = sem_an->sem_action(sem_an, parser, *sem_an_to_free->value);
@@ -269,7 +273,7 @@ static int handle_semantics(Parser *parser, Token *token) {
 
 	if (!sem_stack_empty(parser->sem_an_stack) && ret_code == EXIT_SUCCESS) {
 
-		SemAnalyzer *sem_an = (SemAnalyzer *) sem_stack_top(parser->sem_an_stack);
+		SemAnalyzer *sem_an = sem_stack_top(parser->sem_an_stack);
 		ret_code = sem_an->sem_action(sem_an, parser, SEM_VALUE_TOKEN(token));
 	}
 
@@ -281,9 +285,12 @@ static int handle_semantics(Parser *parser, Token *token) {
  * @param parser Parser
  * @param rule Rule
  */
-static void add_rule_semantics(Parser* parser, Rule* rule) {
-	if (rule->sem_action != NULL)
-		sem_stack_push(parser->sem_an_stack, sem_an_init(rule->sem_action));
+static void add_rule_semantics(Parser* parser, const Rule* rule) {
+	if (rule->sem_action != NULL) {
+		SemAnalyzer sem_an;
+		sem_an_init(&sem_an, rule->sem_action);
+		sem_stack_push(parser->sem_an_stack, &sem_an);
+	}
 }
 
 /**
@@ -291,11 +298,9 @@ static void add_rule_semantics(Parser* parser, Rule* rule) {
  * @param parser Parser
  * @param rule Rule to apply
  */
-static void rewrite_by_rule(Parser* parser, Rule* rule) {
+static void rewrite_by_rule(Parser* parser, const Rule* rule) {
 	// Rewrite it to the rule production (rule production is already reversed)
-	for (int i = 0; rule->production[i] != END_OF_RULE; i++) {
-		stack_push(parser->dtree_stack, &rule->production[i]);
-	}
+	symbol_stack_push_n(parser->dtree_stack, rule->production, rule->length);
 }
 
 /**
@@ -304,12 +309,17 @@ static void rewrite_by_rule(Parser* parser, Rule* rule) {
  * @param current_token Currently processed token
  * @return Rule to apply or NULL if no rule found
  */
-static Rule* get_rule_from_ll_table(unsigned int stack_top, Token* current_token) {
-	// Look at LL table to get index to rule with right production
-	int rule_idx = sparse_table_get(grammar.LL_table, stack_top, get_token_column_value(current_token->id));
-
-	// Get the rule from grammar
-	return grammar.rules[rule_idx];
+static const Rule* get_rule_from_ll_table(unsigned int stack_top, Token* current_token) {
+	// Look at LL table to get index to rule with right production, tokens out of table (e.g. LEX_ERROR) have no rule
+	unsigned int column = get_token_column_value(current_token->id);
+	if (column >= LL_TABLE_COLUMNS)
+		return NULL;
+	unsigned rule_idx = LL_TABLE_GET(stack_top, column);
+
+	// Get the rule from grammar, index 0 means there is no rule
+	if (rule_idx == 0)
+		return NULL;
+	return &grammar.rules[rule_idx];
 }
 
 /**
@@ -319,17 +329,17 @@ static Rule* get_rule_from_ll_table(unsigned int stack_top, Token* current_token
  * @return exit code or RET_CODE_HANDLE_EXPRESSION indicating that expression parser should be called
  */
 static int rewrite_until_terminal(Parser* parser, Token* token) {
-	Rule* rule;  // Temp var for current rule
+	const Rule* rule;  // Temp var for current rule
 
 	// Look at what is on top of the stack
-	unsigned int* s_top = (unsigned int*) stack_top(parser->dtree_stack);
+	unsigned int s_top = symbol_stack_top(parser->dtree_stack);
 
 	// If it is non terminal, rewrite it by rules, until there is terminal (token) in s_top
-	while (*s_top < TERMINALS_START) {  // Non terminal loop
-		if (*s_top == NT_EXPRESSION)
+	while (s_top < TERMINALS_START) {  // Non terminal loop
+		if (s_top == NT_EXPRESSION)
 			return RET_CODE_HANDLE_EXPRESSION;
 
-		rule = get_rule_from_ll_table(*s_top, token);
+		rule = get_rule_from_ll_table(s_top, token);
 
 		// If no rule can be applied, return syntax error
 		if (rule == NULL)
@@ -338,36 +348,58 @@ static int rewrite_until_terminal(Parser* parser, Token* token) {
 		add_rule_semantics(parser, rule);
 
 		// Pop the current non terminal on top of stack
-		stack_pop(parser->dtree_stack);
+		symbol_stack_pop(parser->dtree_stack);
 
 		rewrite_by_rule(parser, rule);
 		// See what is now on top of the stack
-		s_top = (unsigned int*) stack_top(parser->dtree_stack);
+		s_top = symbol_stack_top(parser->dtree_stack);
 	}  // End non terminal loop
 
 	return EXIT_SUCCESS;
 }
 
+Token* parser_token(Parser* parser) {
+	if (parser->tokens == NULL)
+		return scanner_peek(parser->scanner, 0);
+
+	return &parser->token;
+}
+
+void parser_next_token(Parser* parser) {
+	if (parser->tokens == NULL) {
+		scanner_advance(parser->scanner);
+		return;
+	}
+
+	// Last token (EOF or lexical error) is never passed
+	if (parser->token_index + 1 < parser->tokens->count)
+		parser->token_index++;
+	parser->token = token_stream_get(parser->tokens, parser->token_index);
+}
+
 int parse(Parser* parser) {
 	assert(parser != NULL);
 
 	int ret_code;
 
+	if (parser->batch_lexing) {
+		parser->tokens = token_stream_init();
+		scanner_tokenize_parallel(parser->scanner, parser->tokens, parser->lexer_threads);
+		parser->token_index = 0;
+		parser->token = token_stream_get(parser->tokens, 0);
+	}
+
 	// Push ending token and starting non terminal onto stack
-	token_e eof_terminal = TOKEN_EOF;
-	non_terminal_e start_non_terminal = NT_LINE;
-	stack_push(parser->dtree_stack, &eof_terminal);
-	stack_push(parser->dtree_stack, &start_non_terminal);
+	symbol_stack_push(parser->dtree_stack, TOKEN_EOF);
+	symbol_stack_push(parser->dtree_stack, NT_LINE);
 
-	Token* token = NULL;
-	unsigned int* dtree_top;
+	Token* token;
+	bool eof = false;
 
 	// Start processing tokens
 	do {  // Token loop
-		token_free(token);  // Free last token, does nothing when token is NULL
-
-		// Get next token from scanner
-		token = scanner_get_token(parser->scanner);
+		// Look at current token, it stays current until it is processed
+		token = parser_token(parser);
 		if (token->id == LEX_ERROR) {  // Lexical error
 			ret_code = EXIT_LEX_ERROR;
 			break;
@@ -376,34 +408,35 @@ int parse(Parser* parser) {
 		ret_code = rewrite_until_terminal(parser, token);
 
 		if (ret_code == RET_CODE_HANDLE_EXPRESSION) {
-			// Return token to buffer for expression parser
-			scanner_unget_token(parser->scanner, token);
-			token = NULL;
+			// Leave token for expression parser
 			// Call expression parser
 			ret_code = parse_expression(parser);
 
-			stack_pop(parser->dtree_stack);  // Pop expression non terminal from stack
+			symbol_stack_pop(parser->dtree_stack);  // Pop expression non terminal from stack
 		} else if (ret_code == EXIT_SUCCESS) {
-			// Look at what is on top of the stack
-			dtree_top = (unsigned int*) stack_top(parser->dtree_stack);
 			// If the terminal (token) is the same as terminal on top of the stack and no error occurred, pop it from stack
-			if (*dtree_top == token->id) {
-				stack_pop(parser->dtree_stack);
+			if (symbol_stack_top(parser->dtree_stack) == token->id) {
+				symbol_stack_pop(parser->dtree_stack);
 
+				eof = token->id == TOKEN_EOF;
 				ret_code = handle_semantics(parser, token);
+				parser_next_token(parser);
 			} else {
 				// Else there is syntax error
 				ret_code = EXIT_SYNTAX_ERROR;
 			}
 		}
-	} while ((token == NULL || token->id != TOKEN_EOF) && ret_code == EXIT_SUCCESS);  // End token loop
+	} while (!eof && ret_code == EXIT_SUCCESS);  // End token loop
 
 	if (ret_code != EXIT_SUCCESS) {
-		debug("Error occured on line: %d\n", parser->scanner->line);
+		if (parser->tokens != NULL) {
+			debug("Error occured on line: %u, column: %u\n",
+				  parser->tokens->lines[parser->token_index], parser->tokens->columns[parser->token_index] + 1);
+		}
+		else {
+			debug("Error occured on line: %u\n", parser->scanner->line);
+		}
 	}
 
-	token_free(token);
-
-
 	return ret_code;
 }
@@ -11,6 +11,9 @@
 #ifndef IFJ17_COMPILER_PARSER_H
 #define IFJ17_COMPILER_PARSER_H
 
+#define SYM_TAB_ARENA_CHUNK_SIZE 16384
+#define DTREE_STACK_INIT_SIZE 64  // Initial size of derivation tree stack
+
 #include "scanner.h"
 #include "stack.h"
 #include "symtable.h"
@@ -20,11 +23,17 @@
  */
 typedef struct parser_t {
     Scanner* scanner;  /// Input scanner
-    Stack* dtree_stack;  /// Stack for simulating syntax derivation tree
-    DLList* sem_an_stack;  /// Stack of semantic analyzers
+    SymbolStack* dtree_stack;  /// Stack for simulating syntax derivation tree
+    SemStack* sem_an_stack;  /// Stack of semantic analyzers
     DLList* sym_tab_stack;  /// Stack of local symbol tables
     HashTable* sym_tab_global;  /// Global symbol table
     HashTable* sym_tab_functions;  /// Functions symbol table
+    MemArena* sym_tab_arena;  /// Arena holding all symbol tables for the time of parsing
+    bool batch_lexing;  /// Read all tokens into token stream before parsing
+    unsigned lexer_threads;  /// Maximal number of threads lexing input in batch mode
+    TokenStream* tokens;  /// Tokens read before parsing, NULL if tokens are read from scanner during parsing
+    size_t token_index;  /// Index of current token in tokens
+    Token token;  /// Current token from tokens
     DLList* il_override;  /// If this variable is not NULL get_current_il_list will return it
     bool static_var_decl;  /// Indicates if static variable is currently being defined
 	bool step_found; /// Indicates whether for loop has explicitly specified step value
@@ -50,4 +59,17 @@ void parser_free(Parser* parser);
  */
 int parse(Parser* parser);
 
+/**
+ * Get current token
+ * @param parser Parser
+ * @return current token, owned by parser or scanner
+ */
+Token* parser_token(Parser* parser);
+
+/**
+ * Move to next token
+ * @param parser Parser
+ */
+void parser_next_token(Parser* parser);
+
 #endif //IFJ17_COMPILER_PARSER_H
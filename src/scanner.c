@@ -12,158 +12,523 @@
 #include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #include "scanner.h"
 #include "fsm.h"
 #include "buffer.h"
 #include "memory_manager.h"
+#include "intern.h"
+#include "keyword_table.h"
+#include "scanner_simd.h"
 
-#define READ_CHAR() getc(scanner->stream);
-#define STR_IS(keyword) strcmp(str, keyword) == 0
+// Source is terminated by '\0', so only '\0' has to be checked for the end of input
+#define READ_CHAR() (*scanner->cursor != '\0' ? (unsigned char) *scanner->cursor++ : read_nul_char(scanner))
+#define UNGET_CHAR(ch) do { if ((ch) != EOF) scanner->cursor--; } while (0)
 #define APPEND_LOWER_TO_BUFFER(ch) buffer_append_c(scanner->buffer, tolower((char) (ch)));
 #define APPEND_TO_BUFFER(ch) buffer_append_c(scanner->buffer, (char) (ch));
 
+static void dfa_build_tables();
+
 
 Scanner* scanner_init() {
 	Scanner* scanner = (Scanner*) mm_malloc(sizeof(Scanner));
 
 	scanner->buffer = buffer_init(BUFFER_CHUNK);
+	scanner->lexemes = mm_arena_create(LEXEME_ARENA_CHUNK_SIZE);
 
 	scanner->stream = stdin;
-	scanner->backlog_token = NULL;
+	scanner->source = NULL;
+	scanner->cursor = NULL;
+	scanner->end = NULL;
+	scanner->token_start = NULL;
+	scanner->line_starts_size = SCANNER_LINE_TABLE_INIT_SIZE;
+	scanner->line_starts = (size_t*) mm_malloc(sizeof(size_t) * scanner->line_starts_size);
+	scanner->line_starts[0] = 0;
+	scanner->ring_head = 0;
+	scanner->ring_count = 0;
 	scanner->line = 1;
+	scanner->engine = SCANNER_DEFAULT_ENGINE;
+	scanner->intern_identifiers = true;
+
+	dfa_build_tables();
 	return scanner;
 }
 
 void scanner_free(Scanner* scanner) {
 	assert(scanner != NULL);
 	buffer_free(scanner->buffer);
-	token_free(scanner->backlog_token);
+	mm_arena_destroy(scanner->lexemes);
+	mm_free(scanner->line_starts);
+	if (scanner->source != NULL)
+		buffer_free(scanner->source);
 	mm_free(scanner);
 }
 
-static void str_duplicate(char ** str_dst, const char* str_src) {
-	assert(str_dst != NULL);
-	assert(str_src != NULL);
-	// TODO move to utils
-	// Allocate memory for string
-	*str_dst = (char*) mm_malloc(sizeof(char) * (strlen(str_src) + 1));
+static void scanner_pad_source(Scanner* scanner);
+
+/**
+ * Read whole input stream into source buffer
+ * @param scanner Scanner
+ */
+static void scanner_load_source(Scanner* scanner) {
+	scanner->source = buffer_init(SOURCE_READ_CHUNK);
+
+	size_t read;
+	do {
+		buffer_reserve(scanner->source, scanner->source->len + SOURCE_READ_CHUNK);
+		read = fread(scanner->source->str + scanner->source->len, sizeof(char), SOURCE_READ_CHUNK, scanner->stream);
+		scanner->source->len += read;
+	} while (read == SOURCE_READ_CHUNK);
 
-	// Copy string to token
-	strcpy(*str_dst, str_src);
+	scanner_pad_source(scanner);
 }
 
-static token_e get_string_token(const char* str) {
-	assert(str != NULL);
-	size_t len = strlen(str);
+/**
+ * Terminate source by sentinel and padding for scanning by vectors and move cursor to its start
+ * @param scanner Scanner with filled source buffer
+ */
+static void scanner_pad_source(Scanner* scanner) {
+	buffer_reserve(scanner->source, scanner->source->len + SCAN_PADDING);
+	memset(scanner->source->str + scanner->source->len, '\0', SCAN_PADDING + 1);
+	scanner->cursor = scanner->source->str;
+	scanner->end = scanner->source->str + scanner->source->len;
+}
+
+/**
+ * Read '\0' character from source, it can be end of input or actual '\0' from input
+ * @param scanner Scanner
+ * @return read character or EOF
+ */
+static int read_nul_char(Scanner* scanner) {
+	if (scanner->cursor == scanner->end)
+		return EOF;
+
+	scanner->cursor++;
+	return '\0';
+}
+
+/**
+ * Check if character has to be written as escape sequence in IFJcode17 string
+ * @param ch character
+ * @return true if character has to be escaped
+ */
+static bool is_white_char(int ch) {
+	return (ch >= 0 && ch <= 32) || ch == 35 || ch == 92;
+}
 
-	if (len > 1) {
-		if (str[0] == 'a') {
-			if (STR_IS("as")) 			return TOKEN_KW_AS;
-			if (STR_IS("and"))			return TOKEN_KW_AND;
-		} else if (str[0] == 'd') {
-			if (STR_IS("do"))			return TOKEN_KW_DO;
-			if (STR_IS("dim"))			return TOKEN_KW_DIM;
-			if (STR_IS("declare"))		return TOKEN_KW_DECLARE;
-			if (STR_IS("double"))		return TOKEN_KW_DOUBLE;
-		} else if (str[0] == 'e') {
-			if (STR_IS("else"))			return TOKEN_KW_ELSE;
-			if (STR_IS("end"))			return TOKEN_KW_END;
-			if (STR_IS("elseif")) 		return TOKEN_KW_ELSEIF;
-			if (STR_IS("exit")) 		return TOKEN_KW_EXIT;
-		} else if (str[0] == 'f') {
-			if (STR_IS("function")) 	return TOKEN_KW_FUNCTION;
-			if (STR_IS("false")) 		return TOKEN_KW_FALSE;
-			if (STR_IS("for")) 			return TOKEN_KW_FOR;
-		} else if (str[0] == 'i') {
-			if (STR_IS("if")) 			return TOKEN_KW_IF;
-			if (STR_IS("input")) 		return TOKEN_KW_INPUT;
-			if (STR_IS("integer")) 		return TOKEN_KW_INTEGER;
-		} else if (str[0] == 'l') {
-			if (STR_IS("loop")) 		return TOKEN_KW_LOOP;
-		} else if (str[0] == 'n') {
-			if (STR_IS("next")) 		return TOKEN_KW_NEXT;
-			if (STR_IS("not")) 			return TOKEN_KW_NOT;
-		} else if (str[0] == 's') {
-			if (STR_IS("scope")) 		return TOKEN_KW_SCOPE;
-			if (STR_IS("string"))		return TOKEN_KW_STRING;
-			if (STR_IS("step"))			return TOKEN_KW_STEP;
-			if (STR_IS("shared")) 		return TOKEN_KW_SHARED;
-			if (STR_IS("static")) 		return TOKEN_KW_STATIC;
-		} else if (str[0] == 't') {
-			if (STR_IS("then")) 		return TOKEN_KW_THEN;
-			if (STR_IS("to"))			return TOKEN_KW_TO;
-			if (STR_IS("true")) 		return TOKEN_KW_TRUE;
-		} else if (STR_IS("while")) {
-			return TOKEN_KW_WHILE;
-		} else if (STR_IS("or")) {
-			return TOKEN_KW_OR;
-		} else if (STR_IS("print")) {
-			return TOKEN_KW_PRINT;
-		} else if (STR_IS("return")) {
-			return TOKEN_KW_RETURN;
-		} else if (STR_IS("boolean")) {
-			return TOKEN_KW_BOOLEAN;
-		} else if (STR_IS("until")) {
-			return TOKEN_KW_UNTIL;
-		} else if (STR_IS("continue")) {
-			return TOKEN_KW_CONTINUE;
+/**
+ * Get length of string after converting white chars to escape sequences
+ * @param str string to convert
+ * @param len length of str
+ * @return length of converted string
+ */
+static size_t white_char_converted_len(const char* str, size_t len) {
+	size_t converted_len = len;
+	for (size_t i = 0; i < len; i++) {
+		if (is_white_char(str[i]))
+			converted_len += 3;
+	}
+
+	return converted_len;
+}
+
+/**
+ * Convert white chars to escape sequences
+ * @param dst destination, has to have space for white_char_converted_len + 1 characters
+ * @param str string to convert
+ * @param len length of str
+ */
+static void white_char_convert(char* dst, const char* str, size_t len) {
+	for (size_t i = 0; i < len; i++) {
+		int ch = str[i];
+		if (is_white_char(ch)) {
+			*dst++ = '\\';
+			*dst++ = (char) ('0' + ch / 100);
+			*dst++ = (char) ('0' + ch / 10 % 10);
+			*dst++ = (char) ('0' + ch % 10);
+		} else {
+			*dst++ = (char) ch;
 		}
 	}
+	*dst = '\0';
+}
+
+char* convert_white_char(const char* str) {
+	size_t len = strlen(str);
+	char* esc_str = (char*) mm_malloc(sizeof(char) * (white_char_converted_len(str, len) + 1));
+	white_char_convert(esc_str, str, len);
+
+	return esc_str;
+}
+
+/**
+ * Store string literal in scanner lexeme arena, white chars are converted to escape sequences
+ * @param scanner Scanner
+ * @param str decoded string literal
+ * @param len length of str
+ * @return stored string, lives until scanner is freed
+ */
+static char* scanner_store_string(Scanner* scanner, const char* str, size_t len) {
+	char* lexeme = (char*) mm_arena_alloc(scanner->lexemes, sizeof(char) * (white_char_converted_len(str, len) + 1));
+	white_char_convert(lexeme, str, len);
+
+	return lexeme;
+}
 
-	return TOKEN_IDENTIFIER;
+/**
+ * Read identifier or keyword, identifier is read directly from source and it is lower cased only if it is not keyword
+ * @param scanner Scanner, first character of identifier has to be already read
+ * @param token Token to fill
+ */
+static void read_identifier(Scanner* scanner, Token* token) {
+	const char* start = scanner->cursor - 1;
+	scanner->cursor = scan_skip_identifier(scanner->cursor);
+	size_t len = (size_t) (scanner->cursor - start);
+
+	token->id = keyword_lookup(start, len);
+	if (token->id == TOKEN_IDENTIFIER) {
+		buffer_reserve(scanner->buffer, len);
+		for (size_t i = 0; i < len; i++)
+			scanner->buffer->str[i] = (char) tolower(start[i]);
+		scanner->buffer->str[len] = '\0';
+		scanner->buffer->len = len;
+		if (scanner->intern_identifiers)
+			token->data.str = (char*) intern_n(scanner->buffer->str, len);
+		else
+			token->data.str = scanner_store_string(scanner, scanner->buffer->str, len);
+		token->borrowed = true;
+	}
+}
+
+/**
+ * Record start of next line and make it current line
+ * @param scanner Scanner
+ * @param offset Offset of the first character of next line in source
+ */
+static void scanner_add_line(Scanner* scanner, size_t offset) {
+	if (scanner->line == scanner->line_starts_size) {
+		scanner->line_starts_size *= 2;
+		scanner->line_starts = (size_t*) mm_realloc(scanner->line_starts, sizeof(size_t) * scanner->line_starts_size);
+	}
+
+	scanner->line_starts[scanner->line++] = offset;
+}
+
+/**
+ * Count new line which was just read from source
+ * @param scanner Scanner
+ */
+static void scanner_new_line(Scanner* scanner) {
+	scanner_add_line(scanner, (size_t) (scanner->cursor - scanner->source->str));
 }
 
-void scanner_unget_token(Scanner* scanner, Token* token) {
+/**
+ * Append run of decimal digits from source to buffer
+ * @param scanner Scanner
+ */
+static void append_digits(Scanner* scanner) {
+	const char* digits = scanner->cursor;
+	scanner->cursor = scan_skip_digits(digits);
+	buffer_append_n(scanner->buffer, digits, (size_t) (scanner->cursor - digits));
+}
+
+static Token* scanner_fsm_get_token(Scanner* scanner, Token* token);
+static Token* scanner_dfa_get_token(Scanner* scanner, Token* token);
+
+/**
+ * Read next token from source
+ * @param scanner Scanner
+ * @param token Token to fill, its previous content is overwritten
+ */
+static void scanner_read_token(Scanner* scanner, Token* token) {
+	// Input is read on first request, so stream can be set after scanner_init
+	if (scanner->source == NULL)
+		scanner_load_source(scanner);
+
+	buffer_clear(scanner->buffer);
+
+	token->id = LEX_ERROR;
+	token->borrowed = false;
+	token->data.str = NULL;
+
+	if (scanner->engine == SCANNER_ENGINE_DFA)
+		scanner_dfa_get_token(scanner, token);
+	else
+		scanner_fsm_get_token(scanner, token);
+}
+
+Token* scanner_peek(Scanner* scanner, unsigned k) {
 	assert(scanner != NULL);
-	assert(scanner->backlog_token == NULL);
+	assert(scanner->stream != NULL);
+	assert(k < SCANNER_RING_SIZE);
+
+	while (scanner->ring_count <= k) {
+		unsigned index = (scanner->ring_head + scanner->ring_count) & (SCANNER_RING_SIZE - 1);
+		scanner_read_token(scanner, &scanner->ring[index]);
+		scanner->ring_count++;
+	}
 
-	scanner->backlog_token = token;
+	return &scanner->ring[(scanner->ring_head + k) & (SCANNER_RING_SIZE - 1)];
 }
 
-char* convert_white_char(const char* str) {
- 	char* esc_str;
-	int ch;
- 	char esc_seq[5];
+void scanner_advance(Scanner* scanner) {
+	assert(scanner != NULL);
 
-	Buffer *buffer = buffer_init(strlen(str));
+	// Make sure current token was read, so advance never skips unread token
+	scanner_peek(scanner, 0);
+	scanner->ring_head = (scanner->ring_head + 1) & (SCANNER_RING_SIZE - 1);
+	scanner->ring_count--;
+}
 
- 	for (unsigned int i = 0; i < strlen(str); i++) {
-		ch = str[i];
-		if ((ch >= 0 && ch <= 32) || ch == 35 || ch == 92) {
-			sprintf(esc_seq, "\\%03d", ch);
-		} else {
-			esc_seq[0] = str[i];
-			esc_seq[1] = '\0';
+void scanner_tokenize(Scanner* scanner, TokenStream* stream) {
+	assert(scanner != NULL);
+	assert(stream != NULL);
+	assert(scanner->ring_count == 0);
+
+	// Strings of string tokens are stored in string pool of stream
+	MemArena* lexemes = scanner->lexemes;
+	scanner->lexemes = stream->strings;
+
+	Token token;
+	do {
+		unsigned line = scanner->line;
+		scanner_read_token(scanner, &token);
+		unsigned column = (unsigned) (scanner->token_start - scanner->source->str - scanner->line_starts[line - 1]);
+		token_stream_append(stream, &token, line, column);
+	} while (token.id != TOKEN_EOF && token.id != LEX_ERROR);
+
+	scanner->lexemes = lexemes;
+}
+
+/**
+ * Chunk of source lexed by its own scanner
+ */
+typedef struct {
+	Scanner* scanner;  /// Scanner of chunk, its source is copy of chunk
+	size_t offset;  /// Offset in source of the first character of chunk scanner source
+	TokenStream* tokens;  /// Tokens of chunk, lines are counted from the chunk start
+	pthread_t thread;  /// Thread lexing chunk
+	bool started;  /// Thread was started and has to be joined
+} ScannerChunk;
+
+/**
+ * Find out if source segment ends inside block comment, only strings and comments are recognized
+ * @param p first character of segment
+ * @param end end of segment, segment has to end by new line (except the last one)
+ * @param in_comment segment starts inside block comment
+ * @return true if segment ends inside block comment
+ */
+static bool segment_ends_in_comment(const char* p, const char* end, bool in_comment) {
+	while (p < end) {
+		if (in_comment) {
+			p = (const char*) memchr(p, '\'', (size_t) (end - p));
+			if (p == NULL)
+				return true;
+			// Character after apostrophe is consumed even if it does not end comment
+			in_comment = p[1] != '/';
+			p += 2;
+		}
+		else if (*p == '\'') {
+			p = (const char*) memchr(p, '\n', (size_t) (end - p));
+			if (p == NULL)
+				return false;
+			p++;
 		}
-		buffer_append_str(buffer, esc_seq);
- 	}
-	esc_str = (char*) mm_malloc(sizeof(char)*(buffer->len+1));
-	strcpy(esc_str, buffer->str);
-	buffer_free(buffer);
+		else if (*p == '/' && p[1] == '\'') {
+			in_comment = true;
+			p += 2;
+		}
+		else if (*p == '!' && p[1] == '"') {
+			// String ends by quote, new line in string is lexical error
+			for (p += 2; p < end && *p != '"' && *p != '\n'; p++) {
+				if (*p == '\\')
+					p++;
+			}
+			p++;
+		}
+		else {
+			p++;
+		}
+	}
 
-	return esc_str;
+	return in_comment;
 }
 
-Token* scanner_get_token(Scanner* scanner) {
+/**
+ * Create scanner of source chunk, identifiers are not interned (interning is not thread safe)
+ * @param scanner Scanner the chunk is taken from
+ * @param start first character of chunk
+ * @param end end of chunk
+ * @param comment_start chunk starts inside block comment
+ * @param comment_end chunk ends inside block comment
+ * @return new Scanner
+ */
+static Scanner* scanner_chunk_init(const Scanner* scanner, const char* start, const char* end,
+								   bool comment_start, bool comment_end) {
+	Scanner* chunk = scanner_init();
+	chunk->engine = scanner->engine;
+	chunk->intern_identifiers = false;
+
+	// Comment crossing chunk boundary is closed at the end of chunk and opened again at the start of next one
+	chunk->source = buffer_init((size_t) (end - start) + 2 * strlen("/'") + SCAN_PADDING + 1);
+	if (comment_start)
+		buffer_append_str(chunk->source, "/'");
+	buffer_append_n(chunk->source, start, (size_t) (end - start));
+	if (comment_end)
+		buffer_append_str(chunk->source, "'/");
+	scanner_pad_source(chunk);
+
+	return chunk;
+}
+
+/**
+ * Lex source chunk, entry function of chunk thread
+ * @param arg ScannerChunk
+ * @return NULL
+ */
+static void* scanner_chunk_run(void* arg) {
+	ScannerChunk* chunk = (ScannerChunk*) arg;
+	scanner_tokenize(chunk->scanner, chunk->tokens);
+
+	return NULL;
+}
+
+/**
+ * Read all tokens by lexing source chunks in parallel, tokens are the same as tokens of scanner_tokenize
+ * @param scanner Scanner, no token can be peeked
+ * @param stream TokenStream to append tokens to
+ * @param threads Maximal number of threads
+ * @param min_chunk Minimal size of chunk in bytes, smaller input is lexed by calling thread only
+ */
+static void scanner_tokenize_chunks(Scanner* scanner, TokenStream* stream, unsigned threads, size_t min_chunk) {
 	assert(scanner != NULL);
-	assert(scanner->stream != NULL);
+	assert(stream != NULL);
+	assert(scanner->ring_count == 0);
+
+	if (scanner->source == NULL)
+		scanner_load_source(scanner);
+
+	size_t max_count = (size_t) (scanner->end - scanner->cursor) / min_chunk;
+	if (max_count > threads)
+		max_count = threads;
+	if (max_count <= 1) {
+		scanner_tokenize(scanner, stream);
+		return;
+	}
+
+	// Chunks end by new line, so only block comments can cross chunk boundaries
+	ScannerChunk* chunks = (ScannerChunk*) mm_malloc(sizeof(ScannerChunk) * max_count);
+	size_t count = 0;
+	const char* start = scanner->cursor;
+	bool in_comment = false;
+	do {
+		const char* end = scanner->end;
+		if (count + 1 < max_count) {
+			end = start + (scanner->end - start) / (long) (max_count - count);
+			const char* eol = (const char*) memchr(end, '\n', (size_t) (scanner->end - end));
+			end = eol != NULL ? eol + 1 : scanner->end;
+		}
 
-	if (scanner->backlog_token != NULL) {
-		Token* backlog = scanner->backlog_token;
-		scanner->backlog_token = NULL;
-		return backlog;
+		// The last chunk can end by anything, but it is not followed by another chunk
+		bool comment_end = end != scanner->end && segment_ends_in_comment(start, end, in_comment);
+		chunks[count].scanner = scanner_chunk_init(scanner, start, end, in_comment, comment_end);
+		chunks[count].offset = (size_t) (start - scanner->source->str) - (in_comment ? strlen("/'") : 0);
+		chunks[count].tokens = token_stream_init();
+		count++;
+		in_comment = comment_end;
+		start = end;
+	} while (start != scanner->end);
+
+	mem_manager_set_threaded(true);
+	for (size_t i = 1; i < count; i++)
+		chunks[i].started = pthread_create(&chunks[i].thread, NULL, scanner_chunk_run, &chunks[i]) == 0;
+	scanner_chunk_run(&chunks[0]);
+	for (size_t i = 1; i < count; i++) {
+		if (chunks[i].started)
+			pthread_join(chunks[i].thread, NULL);
+		else
+			scanner_chunk_run(&chunks[i]);
 	}
+	mem_manager_set_threaded(false);
 
-	buffer_clear(scanner->buffer);
+	// Join chunk tokens up to the first lexical error, only EOF of the last chunk is kept
+	bool error = false;
+	for (size_t i = 0; i < count; i++) {
+		TokenStream* tokens = chunks[i].tokens;
+		Scanner* chunk = chunks[i].scanner;
+
+		if (!error) {
+			// First line of chunk continues current line, because chunk starts at line start or inside block comment
+			size_t line_start = scanner->line_starts[scanner->line - 1];
+
+			for (size_t j = 0; j < tokens->count && !error; j++) {
+				Token token = token_stream_get(tokens, j);
+				if (token.id == TOKEN_EOF && i + 1 < count)
+					break;
+
+				if (token.id == TOKEN_IDENTIFIER) {
+					token.data.str = (char*) intern(token.data.str);
+				}
+				else if (token.id == TOKEN_STRING) {
+					size_t len = strlen(token.data.str);
+					char* str = (char*) mm_arena_alloc(stream->strings, sizeof(char) * (len + 1));
+					token.data.str = (char*) memcpy(str, token.data.str, len + 1);
+				}
+
+				unsigned column = tokens->columns[j];
+				if (tokens->lines[j] == 1)
+					column = (unsigned) (chunks[i].offset + column - line_start);
 
+				error = token.id == LEX_ERROR;
+				token_stream_append(stream, &token, scanner->line + tokens->lines[j] - 1, column);
+			}
+
+			for (unsigned line = 1; line < chunk->line; line++)
+				scanner_add_line(scanner, chunks[i].offset + chunk->line_starts[line]);
+		}
+
+		token_stream_free(tokens);
+		scanner_free(chunk);
+	}
+	scanner->cursor = scanner->end;
+
+	mm_free(chunks);
+}
+
+void scanner_tokenize_parallel(Scanner* scanner, TokenStream* stream, unsigned threads) {
+	scanner_tokenize_chunks(scanner, stream, threads, SCANNER_PARALLEL_MIN_CHUNK);
+}
+
+size_t scanner_line_offset(const Scanner* scanner, unsigned line) {
+	assert(scanner != NULL);
+	assert(line >= 1 && line <= scanner->line);
+
+	return scanner->line_starts[line - 1];
+}
+
+Token* scanner_get_token(Scanner* scanner) {
+	assert(scanner != NULL);
+
+	Token* token = token_copy(scanner_peek(scanner, 0));
+	scanner_advance(scanner);
+
+	return token;
+}
+
+/**
+ * Read rest of token by goto based finite state machine
+ * @param scanner Scanner
+ * @param token Token to fill
+ * @return token
+ */
+static Token* scanner_fsm_get_token(Scanner* scanner, Token* token) {
 	int ch;
-	Token* token = token_init();
-	token->id = LEX_ERROR;
-	token->data.str = NULL;
 
 	FSM {
 		STATE(s) {
+			scanner->cursor = scan_skip_spaces(scanner->cursor);
+			scanner->token_start = scanner->cursor;
 			ch = READ_CHAR();
 
 			if (ch != '\n' && isspace(ch)) {
@@ -223,7 +588,6 @@ Token* scanner_get_token(Scanner* scanner) {
 			}
 
 			if (('a' <= ch && ch <= 'z') || ('A' <= ch	&& ch <= 'Z') || ch == '_') {
-				APPEND_LOWER_TO_BUFFER(ch);
 				NEXT_STATE(identifier);
 			}
 
@@ -259,7 +623,7 @@ Token* scanner_get_token(Scanner* scanner) {
 		}
 
 		STATE(EOL) {
-			scanner->line++;
+			scanner_new_line(scanner);
 			token->id = TOKEN_EOL;
 			return token;
 		}
@@ -294,13 +658,14 @@ Token* scanner_get_token(Scanner* scanner) {
 				return token;
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_DIVR;
 				return token;
 			}
 		}
 
 		STATE(block_comment) {
+			scanner->cursor = scan_find_apostrophe(scanner->cursor);
 			ch = READ_CHAR();
 			if (ch == '\'') {
 				NEXT_STATE(block_comment_end);
@@ -309,7 +674,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(block_comment);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -324,7 +689,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(block_comment);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -337,7 +702,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				return token;
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_DIVI;
 				return token;
 			}
@@ -350,7 +715,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				return token;
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_MUL;
 				return token;
 			}
@@ -363,7 +728,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				return token;
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_ADD;
 				return token;
 			}
@@ -376,7 +741,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				return token;
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_SUB;
 				return token;
 			}
@@ -391,7 +756,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(ne);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_LT;
 				return token;
 			}
@@ -413,7 +778,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(ge);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_GT;
 				return token;
 			}
@@ -425,24 +790,12 @@ Token* scanner_get_token(Scanner* scanner) {
 		}
 
 		STATE(identifier) {
-			ch = READ_CHAR();
-			if (('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z') || ('0' <= ch && ch <= '9') || ch == '_') {
-				APPEND_LOWER_TO_BUFFER(ch);
-				NEXT_STATE(identifier);
-			}
-			else {
-				ungetc(ch, scanner->stream);
-				token->id = get_string_token(scanner->buffer->str);
-
-				if (token->id == TOKEN_IDENTIFIER) {
-					str_duplicate(&token->data.str, scanner->buffer->str);
-				}
-
-				return token;
-			}
+			read_identifier(scanner, token);
+			return token;
 		}
 
 		STATE(integer) {
+			append_digits(scanner);
 			ch = READ_CHAR();
 			if ('0' <= ch && ch <= '9') {
 				APPEND_LOWER_TO_BUFFER(ch);
@@ -457,7 +810,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(exponent);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 
 
@@ -477,7 +830,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(real_exp);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -490,7 +843,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(real_exp);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -503,13 +856,14 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(real);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
 		}
 
 		STATE(real) {
+			append_digits(scanner);
 			ch = READ_CHAR();
 			if (ch == 'e' || ch == 'E') {
 				APPEND_LOWER_TO_BUFFER(ch);
@@ -520,7 +874,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(real);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_REAL;
 
 				token->data.d = strtod(scanner->buffer->str, NULL);
@@ -529,13 +883,14 @@ Token* scanner_get_token(Scanner* scanner) {
 		}
 
 		STATE(real_exp) {
+			append_digits(scanner);
 			ch = READ_CHAR();
 			if ('0' <= ch && ch <= '9') {
 				APPEND_LOWER_TO_BUFFER(ch);
 				NEXT_STATE(real_exp);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_REAL;
 
 				token->data.d = strtod(scanner->buffer->str, NULL);
@@ -549,7 +904,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(string);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -565,7 +920,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				APPEND_TO_BUFFER(ch);
 				NEXT_STATE(string);
 			} else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -591,7 +946,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(string);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -604,7 +959,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(esc_num_two);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -627,7 +982,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(string);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -635,14 +990,16 @@ Token* scanner_get_token(Scanner* scanner) {
 
 		STATE(string_end) {
 			token->id = TOKEN_STRING;
-			token->data.str = convert_white_char(scanner->buffer->str);
+			token->data.str = scanner_store_string(scanner, scanner->buffer->str, scanner->buffer->len);
+			token->borrowed = true;
 			return token;
 		}
 
 		STATE(line_comment) {
+			scanner->cursor = scan_find_eol(scanner->cursor);
 			ch = READ_CHAR();
 			if (ch == '\n') {
-				scanner->line++;
+				scanner_new_line(scanner);
 				token->id = TOKEN_EOL;
 				return token;
 			}
@@ -671,7 +1028,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(hexa);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = LEX_ERROR;
 				return token;
 			}
@@ -684,7 +1041,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(int_bin);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 				token->data.i = 0;
 				return token;
@@ -698,7 +1055,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(int_octal);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 				token->data.i = 0;
 				return token;
@@ -712,7 +1069,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				NEXT_STATE(int_hexa);
 			}
 			else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 				token->data.i = 0;
 				return token;
@@ -725,7 +1082,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				APPEND_LOWER_TO_BUFFER(ch);
 				NEXT_STATE(int_bin);
 			} else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 
 				token->data.i = (int) strtoul(scanner->buffer->str, NULL, 2);;
@@ -739,7 +1096,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				APPEND_LOWER_TO_BUFFER(ch);
 				NEXT_STATE(int_octal);
 			} else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 
 				token->data.i = (int) strtoul(scanner->buffer->str, NULL, 8);
@@ -753,7 +1110,7 @@ Token* scanner_get_token(Scanner* scanner) {
 				APPEND_LOWER_TO_BUFFER(ch);
 				NEXT_STATE(int_hexa);
 			} else {
-				ungetc(ch, scanner->stream);
+				UNGET_CHAR(ch);
 				token->id = TOKEN_INT;
 
 				token->data.i = (unsigned int) strtoul(scanner->buffer->str, NULL, 16);
@@ -763,3 +1120,516 @@ Token* scanner_get_token(Scanner* scanner) {
 	}
 }
 
+
+/*
+ * Table driven scanner engine
+ *
+ * Every character is mapped to character class by dfa_char_class and next state is
+ * looked up in dfa_next[state][class]. States from DFA_FINAL up are final, they describe
+ * token which is returned (see dfa_finals). Other states can have action which is done
+ * when state is entered (see dfa_entry), e.g. appending read character to buffer.
+ * Semantics of tokens is the same as of goto based FSM engine above.
+ */
+
+/**
+ * Character classes
+ */
+typedef enum {
+	CC_OTHER,  // Characters not listed below (also '\0' which is not end of input)
+	CC_EOF,  // End of input
+	CC_SPACE,  // White space except new line
+	CC_EOL,
+	CC_SEMICOLON,
+	CC_COMMA,
+	CC_EQUAL,
+	CC_LPAR,
+	CC_RPAR,
+	CC_SLASH,
+	CC_BACKSLASH,
+	CC_STAR,
+	CC_PLUS,
+	CC_MINUS,
+	CC_LT,
+	CC_GT,
+	CC_EXCLAMATION,
+	CC_APOSTROPHE,
+	CC_AMPERSAND,
+	CC_QUOTE,
+	CC_DOT,
+	CC_DIGIT_01,
+	CC_DIGIT_2,
+	CC_DIGIT_37,
+	CC_DIGIT_89,
+	CC_LETTER_B,  // b, B
+	CC_LETTER_E,  // e, E
+	CC_LETTER_HEX,  // Hexadecimal digits except b, B, e, E
+	CC_LETTER_O,  // o, O
+	CC_LETTER_H,  // h, H
+	CC_LETTER_N,  // n
+	CC_LETTER_T,  // t
+	CC_LETTER,  // Other letters and '_'
+	CC_COUNT
+} dfa_class_e;
+
+/**
+ * States of table driven engine
+ */
+typedef enum {
+	DS_START,
+	DS_DIV_REAL,
+	DS_BLOCK_COMMENT,
+	DS_BLOCK_COMMENT_END,
+	DS_DIV_INT,
+	DS_MUL,
+	DS_ADD,
+	DS_SUB,
+	DS_LT,
+	DS_GT,
+	DS_INTEGER,
+	DS_EXPONENT,
+	DS_SIGN,
+	DS_FRACTION,
+	DS_REAL,
+	DS_REAL_EXP,
+	DS_STRING_START,
+	DS_STRING,  // States from DS_STRING to DS_STRING_ESC have same transitions
+	DS_STRING_CHAR,
+	DS_STRING_NL,
+	DS_STRING_TAB,
+	DS_STRING_ESC,
+	DS_ESCAPE_SEQ,
+	DS_ESC_NUM_ONE,
+	DS_ESC_NUM_TWO,
+	DS_LINE_COMMENT,
+	DS_BASE,
+	DS_BINARY,
+	DS_OCTAL,
+	DS_HEXA,
+	DS_INT_BIN,
+	DS_INT_OCTAL,
+	DS_INT_HEXA,
+	DS_STATE_COUNT,
+
+	// Final states
+	DF_ERROR = DS_STATE_COUNT,
+	DF_ERROR_UNGET,
+	DF_EOF,
+	DF_EOL,
+	DF_SEMICOLON,
+	DF_COMMA,
+	DF_EQUAL,
+	DF_LPAR,
+	DF_RPAR,
+	DF_DIVR,
+	DF_DIVR_ASIGN,
+	DF_DIVI,
+	DF_DIVI_ASIGN,
+	DF_MUL,
+	DF_MUL_ASIGN,
+	DF_ADD,
+	DF_ADD_ASIGN,
+	DF_SUB,
+	DF_SUB_ASIGN,
+	DF_LT,
+	DF_LE,
+	DF_NE,
+	DF_GT,
+	DF_GE,
+	DF_IDENTIFIER,
+	DF_INT,
+	DF_INT_BIN,
+	DF_INT_OCTAL,
+	DF_INT_HEXA,
+	DF_INT_ZERO,
+	DF_REAL,
+	DF_STRING,
+	DF_COUNT
+} dfa_state_e;
+
+#define DFA_FINAL DS_STATE_COUNT
+
+/**
+ * Actions done when state is entered
+ */
+typedef enum {
+	DA_NONE,
+	DA_APPEND,  // Append read character to buffer
+	DA_APPEND_NL,  // Append '\n' to buffer
+	DA_APPEND_TAB,  // Append '\t' to buffer
+	DA_APPEND_ESC,  // Append read character and replace last three digits by character with their code
+	DA_APPEND_DIGITS,  // Append read character and following digits to buffer
+	DA_SKIP_SPACES,  // Skip following white space
+	DA_SKIP_LINE,  // Skip to end of line
+	DA_SKIP_COMMENT,  // Skip to possible end of block comment
+} dfa_action_e;
+
+/**
+ * Values of final states which need more than token id
+ */
+typedef enum {
+	DV_NONE,
+	DV_LINE,  // Increment line
+	DV_IDENTIFIER,  // Identifier or keyword
+	DV_INT_DEC,
+	DV_INT_BIN,
+	DV_INT_OCTAL,
+	DV_INT_HEXA,
+	DV_INT_ZERO,
+	DV_REAL,
+	DV_STRING,
+} dfa_value_e;
+
+/**
+ * Description of final state
+ */
+typedef struct {
+	token_e id;  /// Token id
+	bool unget;  /// Last read character is not part of token
+	dfa_value_e value;  /// How to get token value
+} DfaFinal;
+
+/// Final states indexed by state - DFA_FINAL
+static const DfaFinal dfa_finals[DF_COUNT - DFA_FINAL] = {
+	{LEX_ERROR, false, DV_NONE},  // DF_ERROR
+	{LEX_ERROR, true, DV_NONE},  // DF_ERROR_UNGET
+	{TOKEN_EOF, true, DV_NONE},  // DF_EOF
+	{TOKEN_EOL, false, DV_LINE},  // DF_EOL
+	{TOKEN_SEMICOLON, false, DV_NONE},  // DF_SEMICOLON
+	{TOKEN_COMMA, false, DV_NONE},  // DF_COMMA
+	{TOKEN_EQUAL, false, DV_NONE},  // DF_EQUAL
+	{TOKEN_LPAR, false, DV_NONE},  // DF_LPAR
+	{TOKEN_RPAR, false, DV_NONE},  // DF_RPAR
+	{TOKEN_DIVR, true, DV_NONE},  // DF_DIVR
+	{TOKEN_DIVR_ASIGN, false, DV_NONE},  // DF_DIVR_ASIGN
+	{TOKEN_DIVI, true, DV_NONE},  // DF_DIVI
+	{TOKEN_DIVI_ASIGN, false, DV_NONE},  // DF_DIVI_ASIGN
+	{TOKEN_MUL, true, DV_NONE},  // DF_MUL
+	{TOKEN_MUL_ASIGN, false, DV_NONE},  // DF_MUL_ASIGN
+	{TOKEN_ADD, true, DV_NONE},  // DF_ADD
+	{TOKEN_ADD_ASIGN, false, DV_NONE},  // DF_ADD_ASIGN
+	{TOKEN_SUB, true, DV_NONE},  // DF_SUB
+	{TOKEN_SUB_ASIGN, false, DV_NONE},  // DF_SUB_ASIGN
+	{TOKEN_LT, true, DV_NONE},  // DF_LT
+	{TOKEN_LE, false, DV_NONE},  // DF_LE
+	{TOKEN_NE, false, DV_NONE},  // DF_NE
+	{TOKEN_GT, true, DV_NONE},  // DF_GT
+	{TOKEN_GE, false, DV_NONE},  // DF_GE
+	{TOKEN_IDENTIFIER, false, DV_IDENTIFIER},  // DF_IDENTIFIER
+	{TOKEN_INT, true, DV_INT_DEC},  // DF_INT
+	{TOKEN_INT, true, DV_INT_BIN},  // DF_INT_BIN
+	{TOKEN_INT, true, DV_INT_OCTAL},  // DF_INT_OCTAL
+	{TOKEN_INT, true, DV_INT_HEXA},  // DF_INT_HEXA
+	{TOKEN_INT, true, DV_INT_ZERO},  // DF_INT_ZERO
+	{TOKEN_REAL, true, DV_REAL},  // DF_REAL
+	{TOKEN_STRING, false, DV_STRING},  // DF_STRING
+};
+
+static unsigned char dfa_char_class[256];  /// Character classes
+static unsigned char dfa_next[DS_STATE_COUNT][CC_COUNT];  /// Transition table
+static unsigned char dfa_entry[DS_STATE_COUNT];  /// Actions done when entering state
+static bool dfa_tables_built = false;
+
+/**
+ * Set transition for all classes in range
+ * @param state State
+ * @param from First class
+ * @param to Last class (inclusive)
+ * @param next Next state
+ */
+static void dfa_set_range(dfa_state_e state, dfa_class_e from, dfa_class_e to, dfa_state_e next) {
+	for (unsigned cls = from; cls <= to; cls++)
+		dfa_next[state][cls] = (unsigned char) next;
+}
+
+/**
+ * Set transition of all classes of state
+ * @param state State
+ * @param next Next state
+ */
+static void dfa_set_default(dfa_state_e state, dfa_state_e next) {
+	dfa_set_range(state, CC_OTHER, (dfa_class_e) (CC_COUNT - 1), next);
+}
+
+/**
+ * Set transitions to state which accepts token if next character is '=', otherwise ungets it
+ * @param state State
+ * @param assign Final state for token with '='
+ * @param other Final state for token without '='
+ */
+static void dfa_set_assign(dfa_state_e state, dfa_state_e assign, dfa_state_e other) {
+	dfa_set_default(state, other);
+	dfa_next[state][CC_EQUAL] = (unsigned char) assign;
+}
+
+/**
+ * Build character class and transition tables, tables are built only once
+ */
+static void dfa_build_tables() {
+	if (dfa_tables_built)
+		return;
+
+	// Character classes
+	static const struct {
+		const char* chars;
+		dfa_class_e cls;
+	} classes[] = {
+		{" \t\v\f\r", CC_SPACE}, {"\n", CC_EOL}, {";", CC_SEMICOLON}, {",", CC_COMMA}, {"=", CC_EQUAL},
+		{"(", CC_LPAR}, {")", CC_RPAR}, {"/", CC_SLASH}, {"\\", CC_BACKSLASH}, {"*", CC_STAR},
+		{"+", CC_PLUS}, {"-", CC_MINUS}, {"<", CC_LT}, {">", CC_GT}, {"!", CC_EXCLAMATION},
+		{"'", CC_APOSTROPHE}, {"&", CC_AMPERSAND}, {"\"", CC_QUOTE}, {".", CC_DOT},
+		{"01", CC_DIGIT_01}, {"2", CC_DIGIT_2}, {"34567", CC_DIGIT_37}, {"89", CC_DIGIT_89},
+		{"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_", CC_LETTER},
+		{"acdfACDF", CC_LETTER_HEX}, {"bB", CC_LETTER_B}, {"eE", CC_LETTER_E}, {"oO", CC_LETTER_O},
+		{"hH", CC_LETTER_H}, {"n", CC_LETTER_N}, {"t", CC_LETTER_T},
+	};
+
+	memset(dfa_char_class, CC_OTHER, sizeof(dfa_char_class));
+	for (size_t i = 0; i < sizeof(classes) / sizeof(classes[0]); i++) {
+		for (const char* ch = classes[i].chars; *ch != '\0'; ch++)
+			dfa_char_class[(unsigned char) *ch] = (unsigned char) classes[i].cls;
+	}
+
+	// Start state
+	dfa_set_default(DS_START, DF_ERROR);
+	dfa_next[DS_START][CC_EOF] = DF_EOF;
+	dfa_next[DS_START][CC_SPACE] = DS_START;
+	dfa_next[DS_START][CC_EOL] = DF_EOL;
+	dfa_next[DS_START][CC_SEMICOLON] = DF_SEMICOLON;
+	dfa_next[DS_START][CC_COMMA] = DF_COMMA;
+	dfa_next[DS_START][CC_EQUAL] = DF_EQUAL;
+	dfa_next[DS_START][CC_LPAR] = DF_LPAR;
+	dfa_next[DS_START][CC_RPAR] = DF_RPAR;
+	dfa_next[DS_START][CC_SLASH] = DS_DIV_REAL;
+	dfa_next[DS_START][CC_BACKSLASH] = DS_DIV_INT;
+	dfa_next[DS_START][CC_STAR] = DS_MUL;
+	dfa_next[DS_START][CC_PLUS] = DS_ADD;
+	dfa_next[DS_START][CC_MINUS] = DS_SUB;
+	dfa_next[DS_START][CC_LT] = DS_LT;
+	dfa_next[DS_START][CC_GT] = DS_GT;
+	dfa_next[DS_START][CC_EXCLAMATION] = DS_STRING_START;
+	dfa_next[DS_START][CC_APOSTROPHE] = DS_LINE_COMMENT;
+	dfa_next[DS_START][CC_AMPERSAND] = DS_BASE;
+	dfa_set_range(DS_START, CC_DIGIT_01, CC_DIGIT_89, DS_INTEGER);
+	dfa_set_range(DS_START, CC_LETTER_B, CC_LETTER, DF_IDENTIFIER);
+
+	// Operators and comments
+	dfa_set_default(DS_DIV_REAL, DF_DIVR);
+	dfa_next[DS_DIV_REAL][CC_EQUAL] = DF_DIVR_ASIGN;
+	dfa_next[DS_DIV_REAL][CC_APOSTROPHE] = DS_BLOCK_COMMENT;
+
+	dfa_set_default(DS_BLOCK_COMMENT, DS_BLOCK_COMMENT);
+	dfa_next[DS_BLOCK_COMMENT][CC_APOSTROPHE] = DS_BLOCK_COMMENT_END;
+	dfa_next[DS_BLOCK_COMMENT][CC_EOF] = DF_ERROR_UNGET;
+
+	dfa_set_default(DS_BLOCK_COMMENT_END, DS_BLOCK_COMMENT);
+	dfa_next[DS_BLOCK_COMMENT_END][CC_SLASH] = DS_START;
+	dfa_next[DS_BLOCK_COMMENT_END][CC_EOF] = DF_ERROR_UNGET;
+
+	dfa_set_default(DS_LINE_COMMENT, DS_LINE_COMMENT);
+	dfa_next[DS_LINE_COMMENT][CC_EOL] = DF_EOL;
+	dfa_next[DS_LINE_COMMENT][CC_EOF] = DF_EOF;
+
+	dfa_set_assign(DS_DIV_INT, DF_DIVI_ASIGN, DF_DIVI);
+	dfa_set_assign(DS_MUL, DF_MUL_ASIGN, DF_MUL);
+	dfa_set_assign(DS_ADD, DF_ADD_ASIGN, DF_ADD);
+	dfa_set_assign(DS_SUB, DF_SUB_ASIGN, DF_SUB);
+	dfa_set_assign(DS_LT, DF_LE, DF_LT);
+	dfa_next[DS_LT][CC_GT] = DF_NE;
+	dfa_set_assign(DS_GT, DF_GE, DF_GT);
+
+	// Decimal numbers
+	dfa_set_default(DS_INTEGER, DF_INT);
+	dfa_set_range(DS_INTEGER, CC_DIGIT_01, CC_DIGIT_89, DS_INTEGER);
+	dfa_next[DS_INTEGER][CC_DOT] = DS_FRACTION;
+	dfa_next[DS_INTEGER][CC_LETTER_E] = DS_EXPONENT;
+
+	dfa_set_default(DS_FRACTION, DF_ERROR_UNGET);
+	dfa_set_range(DS_FRACTION, CC_DIGIT_01, CC_DIGIT_89, DS_REAL);
+
+	dfa_set_default(DS_REAL, DF_REAL);
+	dfa_set_range(DS_REAL, CC_DIGIT_01, CC_DIGIT_89, DS_REAL);
+	dfa_next[DS_REAL][CC_LETTER_E] = DS_EXPONENT;
+
+	dfa_set_default(DS_EXPONENT, DF_ERROR_UNGET);
+	dfa_set_range(DS_EXPONENT, CC_DIGIT_01, CC_DIGIT_89, DS_REAL_EXP);
+	dfa_next[DS_EXPONENT][CC_PLUS] = DS_SIGN;
+	dfa_next[DS_EXPONENT][CC_MINUS] = DS_SIGN;
+
+	dfa_set_default(DS_SIGN, DF_ERROR_UNGET);
+	dfa_set_range(DS_SIGN, CC_DIGIT_01, CC_DIGIT_89, DS_REAL_EXP);
+
+	dfa_set_default(DS_REAL_EXP, DF_REAL);
+	dfa_set_range(DS_REAL_EXP, CC_DIGIT_01, CC_DIGIT_89, DS_REAL_EXP);
+
+	// Strings
+	dfa_set_default(DS_STRING_START, DF_ERROR_UNGET);
+	dfa_next[DS_STRING_START][CC_QUOTE] = DS_STRING;
+
+	dfa_set_default(DS_STRING, DS_STRING_CHAR);
+	dfa_next[DS_STRING][CC_BACKSLASH] = DS_ESCAPE_SEQ;
+	dfa_next[DS_STRING][CC_QUOTE] = DF_STRING;
+	dfa_next[DS_STRING][CC_EOL] = DF_ERROR_UNGET;
+	dfa_next[DS_STRING][CC_EOF] = DF_ERROR_UNGET;
+	for (int state = DS_STRING_CHAR; state <= DS_STRING_ESC; state++)
+		memcpy(dfa_next[state], dfa_next[DS_STRING], sizeof(dfa_next[DS_STRING]));
+
+	dfa_set_default(DS_ESCAPE_SEQ, DF_ERROR_UNGET);
+	dfa_set_range(DS_ESCAPE_SEQ, CC_DIGIT_01, CC_DIGIT_2, DS_ESC_NUM_ONE);
+	dfa_next[DS_ESCAPE_SEQ][CC_QUOTE] = DS_STRING_CHAR;
+	dfa_next[DS_ESCAPE_SEQ][CC_BACKSLASH] = DS_STRING_CHAR;
+	dfa_next[DS_ESCAPE_SEQ][CC_LETTER_N] = DS_STRING_NL;
+	dfa_next[DS_ESCAPE_SEQ][CC_LETTER_T] = DS_STRING_TAB;
+
+	dfa_set_default(DS_ESC_NUM_ONE, DF_ERROR_UNGET);
+	dfa_set_range(DS_ESC_NUM_ONE, CC_DIGIT_01, CC_DIGIT_89, DS_ESC_NUM_TWO);
+
+	dfa_set_default(DS_ESC_NUM_TWO, DF_ERROR_UNGET);
+	dfa_set_range(DS_ESC_NUM_TWO, CC_DIGIT_01, CC_DIGIT_89, DS_STRING_ESC);
+
+	// Numbers in other bases
+	dfa_set_default(DS_BASE, DF_ERROR_UNGET);
+	dfa_next[DS_BASE][CC_LETTER_B] = DS_BINARY;
+	dfa_next[DS_BASE][CC_LETTER_O] = DS_OCTAL;
+	dfa_next[DS_BASE][CC_LETTER_H] = DS_HEXA;
+
+	dfa_set_default(DS_BINARY, DF_INT_ZERO);
+	dfa_set_default(DS_INT_BIN, DF_INT_BIN);
+	dfa_set_range(DS_BINARY, CC_DIGIT_01, CC_DIGIT_01, DS_INT_BIN);
+	dfa_set_range(DS_INT_BIN, CC_DIGIT_01, CC_DIGIT_01, DS_INT_BIN);
+
+	dfa_set_default(DS_OCTAL, DF_INT_ZERO);
+	dfa_set_default(DS_INT_OCTAL, DF_INT_OCTAL);
+	dfa_set_range(DS_OCTAL, CC_DIGIT_01, CC_DIGIT_37, DS_INT_OCTAL);
+	dfa_set_range(DS_INT_OCTAL, CC_DIGIT_01, CC_DIGIT_37, DS_INT_OCTAL);
+
+	dfa_set_default(DS_HEXA, DF_INT_ZERO);
+	dfa_set_default(DS_INT_HEXA, DF_INT_HEXA);
+	dfa_set_range(DS_HEXA, CC_DIGIT_01, CC_LETTER_HEX, DS_INT_HEXA);
+	dfa_set_range(DS_INT_HEXA, CC_DIGIT_01, CC_LETTER_HEX, DS_INT_HEXA);
+
+	// Entry actions
+	memset(dfa_entry, DA_NONE, sizeof(dfa_entry));
+	static const dfa_state_e appending[] = {
+		DS_INTEGER, DS_EXPONENT, DS_SIGN, DS_FRACTION, DS_REAL, DS_REAL_EXP, DS_STRING_CHAR,
+		DS_ESC_NUM_ONE, DS_ESC_NUM_TWO, DS_INT_BIN, DS_INT_OCTAL, DS_INT_HEXA
+	};
+	for (size_t i = 0; i < sizeof(appending) / sizeof(appending[0]); i++)
+		dfa_entry[appending[i]] = DA_APPEND;
+	dfa_entry[DS_STRING_NL] = DA_APPEND_NL;
+	dfa_entry[DS_STRING_TAB] = DA_APPEND_TAB;
+	dfa_entry[DS_STRING_ESC] = DA_APPEND_ESC;
+	dfa_entry[DS_INTEGER] = DA_APPEND_DIGITS;
+	dfa_entry[DS_REAL] = DA_APPEND_DIGITS;
+	dfa_entry[DS_REAL_EXP] = DA_APPEND_DIGITS;
+	dfa_entry[DS_START] = DA_SKIP_SPACES;
+	dfa_entry[DS_LINE_COMMENT] = DA_SKIP_LINE;
+	dfa_entry[DS_BLOCK_COMMENT] = DA_SKIP_COMMENT;
+
+	dfa_tables_built = true;
+}
+
+/**
+ * Read rest of token by table driven engine
+ * @param scanner Scanner
+ * @param token Token to fill
+ * @return token
+ */
+static Token* scanner_dfa_get_token(Scanner* scanner, Token* token) {
+	unsigned state = DS_START;
+	scanner->cursor = scan_skip_spaces(scanner->cursor);
+	scanner->token_start = scanner->cursor;
+
+	while (true) {
+		unsigned char ch = (unsigned char) *scanner->cursor;
+		unsigned cls = dfa_char_class[ch];
+		if (ch == '\0' && scanner->cursor == scanner->end)
+			cls = CC_EOF;
+
+		state = dfa_next[state][cls];
+
+		if (state >= DFA_FINAL)
+			break;
+
+		scanner->cursor++;
+		switch (dfa_entry[state]) {
+			case DA_NONE:
+				break;
+			case DA_APPEND:
+				buffer_append_c(scanner->buffer, (char) ch);
+				break;
+			case DA_APPEND_NL:
+				buffer_append_c(scanner->buffer, '\n');
+				break;
+			case DA_APPEND_TAB:
+				buffer_append_c(scanner->buffer, '\t');
+				break;
+			case DA_APPEND_DIGITS:
+				buffer_append_c(scanner->buffer, (char) ch);
+				append_digits(scanner);
+				break;
+			case DA_SKIP_SPACES:
+				scanner->cursor = scan_skip_spaces(scanner->cursor);
+				scanner->token_start = scanner->cursor;
+				break;
+			case DA_SKIP_LINE:
+				scanner->cursor = scan_find_eol(scanner->cursor);
+				break;
+			case DA_SKIP_COMMENT:
+				scanner->cursor = scan_find_apostrophe(scanner->cursor);
+				break;
+			case DA_APPEND_ESC: {
+				buffer_append_c(scanner->buffer, (char) ch);
+
+				int esc_ch = (int) strtol(&scanner->buffer->str[scanner->buffer->len - 3], NULL, 10);
+				if (esc_ch == 0 || esc_ch > 255) {
+					token->id = LEX_ERROR;
+					return token;
+				}
+				scanner->buffer->len -= 3;
+				scanner->buffer->str[scanner->buffer->len] = '\0';
+				buffer_append_c(scanner->buffer, (char) esc_ch);
+				break;
+			}
+		}
+	}
+
+	const DfaFinal* accept = &dfa_finals[state - DFA_FINAL];
+	if (!accept->unget)
+		scanner->cursor++;
+
+	token->id = accept->id;
+	switch (accept->value) {
+		case DV_NONE:
+			break;
+		case DV_LINE:
+			scanner_new_line(scanner);
+			break;
+		case DV_IDENTIFIER:
+			read_identifier(scanner, token);
+			break;
+		case DV_INT_DEC:
+			token->data.i = (unsigned int) strtoul(scanner->buffer->str, NULL, 10);
+			break;
+		case DV_INT_BIN:
+			token->data.i = (int) strtoul(scanner->buffer->str, NULL, 2);
+			break;
+		case DV_INT_OCTAL:
+			token->data.i = (int) strtoul(scanner->buffer->str, NULL, 8);
+			break;
+		case DV_INT_HEXA:
+			token->data.i = (unsigned int) strtoul(scanner->buffer->str, NULL, 16);
+			break;
+		case DV_INT_ZERO:
+			token->data.i = 0;
+			break;
+		case DV_REAL:
+			token->data.d = strtod(scanner->buffer->str, NULL);
+			break;
+		case DV_STRING:
+			token->data.str = scanner_store_string(scanner, scanner->buffer->str, scanner->buffer->len);
+			token->borrowed = true;
+			break;
+	}
+
+	return token;
+}
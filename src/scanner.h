@@ -14,16 +14,46 @@
 #include "symtable.h"
 #include "buffer.h"
 #include "token.h"
+#include "token_stream.h"
+
+#define SOURCE_READ_CHUNK 65536
+#define LEXEME_ARENA_CHUNK_SIZE 16384
+#define SCANNER_RING_SIZE 8  // Has to be power of two, maximal lookahead is SCANNER_RING_SIZE - 1
+#define SCANNER_PARALLEL_MIN_CHUNK (1024 * 1024)  // Smaller inputs are not worth lexing in parallel
+#define SCANNER_LINE_TABLE_INIT_SIZE 256
+
+/**
+ * Scanner engines, they produce the same tokens
+ */
+typedef enum {
+	SCANNER_ENGINE_FSM,  /// Goto based finite state machine
+	SCANNER_ENGINE_DFA,  /// Character class and transition tables
+} scanner_engine_e;
+
+#ifndef SCANNER_DEFAULT_ENGINE
+#define SCANNER_DEFAULT_ENGINE SCANNER_ENGINE_FSM  // Can be set by -DSCANNER_DEFAULT_ENGINE=SCANNER_ENGINE_DFA
+#endif
 
 
 /**
  * Scanner object structure
  */
 typedef struct {
-	FILE* stream;  /// Input stream
+	FILE* stream;  /// Input stream, it is read at once on first scanner_get_token
+	Buffer* source;  /// Whole input terminated by '\0', NULL until input is read
+	const char* cursor;  /// Position of next character in source
+	const char* end;  /// End of input in source
+	const char* token_start;  /// First character of last read token in source
+	size_t* line_starts;  /// Offsets of line starts in source, line n starts at line_starts[n - 1]
+	unsigned line_starts_size;  /// Allocated size of line_starts
     Buffer* buffer;  /// Buffer for string and identifier strings
-	Token* backlog_token; /// Backlog token
-	unsigned line;  /// Current line number
+	MemArena* lexemes;  /// Strings of string tokens, tokens only borrow them (identifiers are interned)
+	Token ring[SCANNER_RING_SIZE];  /// Ring of lookahead tokens, their strings are owned by scanner
+	unsigned ring_head;  /// Index of current token in ring
+	unsigned ring_count;  /// Number of read tokens in ring
+	unsigned line;  /// Current line number (new lines in block comments are not counted)
+	scanner_engine_e engine;  /// Engine used to read tokens
+	bool intern_identifiers;  /// Identifiers are interned, otherwise they are stored in lexemes
 } Scanner;
 
 /**
@@ -39,17 +69,48 @@ Scanner* scanner_init();
 void scanner_free(Scanner* scanner);
 
 /**
- * Get next token
- * @return token
+ * Get next token and advance, strings of identifier and string tokens are owned by scanner
+ * @param scanner Scanner
+ * @return token, has to be freed by token_free
  */
 Token* scanner_get_token(Scanner* scanner);
 
 /**
- * Return backlog token, only one token can be in backlog
+ * Read all tokens up to EOF or lexical error (including it) at once
+ * @param scanner Scanner, no token can be peeked
+ * @param stream TokenStream to append tokens to
+ */
+void scanner_tokenize(Scanner* scanner, TokenStream* stream);
+
+/**
+ * Read all tokens up to EOF or lexical error (including it) at once, input is split to chunks lexed in parallel
+ * @param scanner Scanner, no token can be peeked
+ * @param stream TokenStream to append tokens to
+ * @param threads Maximal number of threads, input smaller than SCANNER_PARALLEL_MIN_CHUNK per thread is lexed serially
+ */
+void scanner_tokenize_parallel(Scanner* scanner, TokenStream* stream, unsigned threads);
+
+/**
+ * Get offset of line start in source
+ * @param scanner Scanner
+ * @param line Line number, has to be at most scanner->line
+ * @return offset of the first character of line in source
+ */
+size_t scanner_line_offset(const Scanner* scanner, unsigned line);
+
+/**
+ * Look at token k positions after current token without advancing
+ * @param scanner Scanner
+ * @param k lookahead, 0 is current token, has to be less than SCANNER_RING_SIZE
+ * @return token stored in scanner, valid until it is advanced over and SCANNER_RING_SIZE more tokens are read
+ */
+Token* scanner_peek(Scanner* scanner, unsigned k);
+
+/**
+ * Advance to next token
  * @param scanner Scanner
- * @param token Token to backlog
  */
-void scanner_unget_token(Scanner* scanner, Token* token);
+void scanner_advance(Scanner* scanner);
 
 /**
  * Convert white chars to escape sequences
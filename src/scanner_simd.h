@@ -0,0 +1,170 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+#ifndef IFJ17_COMPILER_SCANNER_SIMD_H
+#define IFJ17_COMPILER_SCANNER_SIMD_H
+
+/*
+ * Functions skipping runs of characters in scanner source
+ *
+ * Source has to be terminated by '\0' followed by at least SCAN_PADDING readable bytes,
+ * because characters are tested by whole vectors. Every function stops at '\0' at the latest.
+ * AVX2 is used if compiled with -mavx2, SSE2 on other x86 and scalar code elsewhere.
+ */
+
+#include <stddef.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SCAN_VECTOR_SIZE 32
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_VECTOR_SIZE 16
+#else
+#define SCAN_VECTOR_SIZE 1
+#endif
+
+#define SCAN_PADDING 32  // Has to be at least SCAN_VECTOR_SIZE
+
+#if defined(__AVX2__)
+
+typedef __m256i ScanVector;
+#define SCAN_LOAD(p) _mm256_loadu_si256((const __m256i*) (p))
+#define SCAN_SET(ch) _mm256_set1_epi8((char) (ch))
+#define SCAN_EQ(a, b) _mm256_cmpeq_epi8(a, b)
+#define SCAN_GT(a, b) _mm256_cmpgt_epi8(a, b)
+#define SCAN_OR(a, b) _mm256_or_si256(a, b)
+#define SCAN_AND(a, b) _mm256_and_si256(a, b)
+#define SCAN_MASK(a) ((unsigned) _mm256_movemask_epi8(a))
+#define SCAN_NOT(mask) (~(mask))
+
+#elif defined(__SSE2__)
+
+typedef __m128i ScanVector;
+#define SCAN_LOAD(p) _mm_loadu_si128((const __m128i*) (p))
+#define SCAN_SET(ch) _mm_set1_epi8((char) (ch))
+#define SCAN_EQ(a, b) _mm_cmpeq_epi8(a, b)
+#define SCAN_GT(a, b) _mm_cmpgt_epi8(a, b)
+#define SCAN_OR(a, b) _mm_or_si128(a, b)
+#define SCAN_AND(a, b) _mm_and_si128(a, b)
+#define SCAN_MASK(a) ((unsigned) _mm_movemask_epi8(a))
+#define SCAN_NOT(mask) (~(mask) & 0xFFFFu)
+
+#endif
+
+#if SCAN_VECTOR_SIZE > 1
+
+/// Vector of bytes set to 0xFF where character is in [lo, hi], only for ASCII ranges (signed compare)
+#define SCAN_IN_RANGE(v, lo, hi) SCAN_AND(SCAN_GT(v, SCAN_SET((lo) - 1)), SCAN_GT(SCAN_SET((hi) + 1), v))
+
+/**
+ * Skip vectors while mask of matching characters returned by match is zero
+ * @param p first character
+ * @param mask variable for mask
+ * @param match expression computing mask from vector v
+ * @return pointer to first matching character
+ */
+#define SCAN_UNTIL(p, mask, match) \
+	do { \
+		for (;; (p) += SCAN_VECTOR_SIZE) { \
+			ScanVector v = SCAN_LOAD(p); \
+			(mask) = (match); \
+			if ((mask) != 0) \
+				return (p) + __builtin_ctz(mask); \
+		} \
+	} while (0)
+
+#endif
+
+/**
+ * Skip white space except new line (' ', '\t', '\v', '\f', '\r')
+ * @param p first character
+ * @return pointer to first character which is not skipped
+ */
+static const char* scan_skip_spaces(const char* p) {
+#if SCAN_VECTOR_SIZE > 1
+	unsigned mask;
+	// Not space is (ch != ' ') && !(ch in ['\t', '\r'] && ch != '\n')
+	SCAN_UNTIL(p, mask, SCAN_NOT(SCAN_MASK(SCAN_EQ(v, SCAN_SET(' ')))
+			| (SCAN_MASK(SCAN_IN_RANGE(v, '\t', '\r')) & ~SCAN_MASK(SCAN_EQ(v, SCAN_SET('\n'))))));
+#else
+	while (*p == ' ' || (*p >= '\t' && *p <= '\r' && *p != '\n'))
+		p++;
+	return p;
+#endif
+}
+
+/**
+ * Find end of line comment
+ * @param p first character
+ * @return pointer to first '\n' or '\0'
+ */
+static const char* scan_find_eol(const char* p) {
+#if SCAN_VECTOR_SIZE > 1
+	unsigned mask;
+	SCAN_UNTIL(p, mask, SCAN_MASK(SCAN_OR(SCAN_EQ(v, SCAN_SET('\n')), SCAN_EQ(v, SCAN_SET('\0')))));
+#else
+	while (*p != '\n' && *p != '\0')
+		p++;
+	return p;
+#endif
+}
+
+/**
+ * Find possible end of block comment
+ * @param p first character
+ * @return pointer to first '\'' or '\0'
+ */
+static const char* scan_find_apostrophe(const char* p) {
+#if SCAN_VECTOR_SIZE > 1
+	unsigned mask;
+	SCAN_UNTIL(p, mask, SCAN_MASK(SCAN_OR(SCAN_EQ(v, SCAN_SET('\'')), SCAN_EQ(v, SCAN_SET('\0')))));
+#else
+	while (*p != '\'' && *p != '\0')
+		p++;
+	return p;
+#endif
+}
+
+/**
+ * Skip letters, digits and '_'
+ * @param p first character
+ * @return pointer to first character which is not skipped
+ */
+static const char* scan_skip_identifier(const char* p) {
+#if SCAN_VECTOR_SIZE > 1
+	unsigned mask;
+	// Setting 0x20 bit converts upper case letters to lower case
+	SCAN_UNTIL(p, mask, SCAN_NOT(SCAN_MASK(SCAN_IN_RANGE(SCAN_OR(v, SCAN_SET(0x20)), 'a', 'z'))
+			| SCAN_MASK(SCAN_IN_RANGE(v, '0', '9'))
+			| SCAN_MASK(SCAN_EQ(v, SCAN_SET('_')))));
+#else
+	while (('a' <= (*p | 0x20) && (*p | 0x20) <= 'z') || ('0' <= *p && *p <= '9') || *p == '_')
+		p++;
+	return p;
+#endif
+}
+
+/**
+ * Skip decimal digits
+ * @param p first character
+ * @return pointer to first character which is not digit
+ */
+static const char* scan_skip_digits(const char* p) {
+#if SCAN_VECTOR_SIZE > 1
+	unsigned mask;
+	SCAN_UNTIL(p, mask, SCAN_NOT(SCAN_MASK(SCAN_IN_RANGE(v, '0', '9'))));
+#else
+	while ('0' <= *p && *p <= '9')
+		p++;
+	return p;
+#endif
+}
+
+#endif //IFJ17_COMPILER_SCANNER_SIMD_H
@@ -21,13 +21,14 @@
 #include "debug.h"
 #include "utils.h"
 #include "memory_manager.h"
+#include "intern.h"
 
 #define SEM_FSM switch(sem_an->state)
 #define SEM_STATE(state) case state:
 #define END_STATE break
 #define SEM_ERROR_STATE default: return EXIT_INTERN_ERROR
 #define SEM_NEXT_STATE(s) sem_an->state = s
-#define SEM_SET_EXPR_TYPE(type) sem_an->value = sem_value_init(); \
+#define SEM_SET_EXPR_TYPE(type) sem_an_value_init(sem_an); \
 		sem_an->value->value_type = VTYPE_EXPR; \
 		sem_an->value->expr_type = type
 
@@ -46,35 +47,49 @@
 #define LABEL_PREFIX_FOR_EQUAL "FOR_EQUAL_"
 
 
-SemAnalyzer* sem_an_init(semantic_action_f sem_action) {
-	SemAnalyzer* sem_an = (SemAnalyzer*) mm_malloc(sizeof(SemAnalyzer));
-
+void sem_an_init(SemAnalyzer* sem_an, semantic_action_f sem_action) {
 	sem_an->sem_action = sem_action;
 	sem_an->finished = false;
 	sem_an->state = SEM_STATE_START;
 	sem_an->value = NULL;
-
-	return sem_an;
 }
 
-void sem_an_free(void* sem_an) {
-	if (((SemAnalyzer*) sem_an)->value != NULL) {
-		sem_value_free(((SemAnalyzer*) sem_an)->value);
+/**
+ * Free data owned by semantic value, value itself is not freed
+ * @param value SemValue
+ */
+static void sem_value_release(SemValue* value) {
+	switch (value->value_type) {
+		case VTYPE_TOKEN:
+			token_free(value->token);
+			break;
+		case VTYPE_ID:	// Can't free reference to symbol table
+			break;
+		case VTYPE_LIST:
+			dllist_free(value->list);
+			break;
+		case VTYPE_IF:
+			if (value->if_val.if_id != NULL)
+				mm_free(value->if_val.if_id);
+			if (value->if_val.elseif_id != NULL)
+				mm_free(value->if_val.elseif_id);
+			break;
+		case VTYPE_FOR:
+			mm_free(value->for_val.uid);
+			mm_free(value->for_val.step_id);
+			mm_free(value->for_val.endval_id);
+		default:
+			break;
 	}
-
-	mm_free(sem_an);
 }
 
-SemValue* sem_value_init() {
-	return (SemValue*) mm_malloc(sizeof(SemValue));
-}
-
-SemValue* sem_value_copy(const SemValue* value) {
-	if (value == NULL)
-		return NULL;
-
-	SemValue* new_val = (SemValue*) mm_malloc(sizeof(SemValue));
-
+/**
+ * Deep copy semantic value to given storage, but only move VTYPE_LIST
+ * @param new_val Storage of copy
+ * @param value semantic value
+ * @return false if value can not be copied
+ */
+static bool sem_value_copy_to(SemValue* new_val, const SemValue* value) {
 	new_val->value_type = value->value_type;
 
 	switch (value->value_type) {
@@ -100,7 +115,53 @@ SemValue* sem_value_copy(const SemValue* value) {
 			new_val->if_val.elseif_id = (char*) mm_malloc(sizeof(char) * (strlen(value->if_val.elseif_id) + 1));
 			break;
 		default:
-			return NULL;
+			return false;
+	}
+
+	return true;
+}
+
+void sem_an_free(SemAnalyzer* sem_an) {
+	if (sem_an->value != NULL) {
+		sem_value_release(sem_an->value);
+		sem_an->value = NULL;
+	}
+}
+
+/**
+ * Initialize value of semantic analyzer in its storage
+ * @param sem_an SemAnalyzer
+ * @return value of sem_an
+ */
+static SemValue* sem_an_value_init(SemAnalyzer* sem_an) {
+	sem_an->value = &sem_an->value_storage;
+	return sem_an->value;
+}
+
+/**
+ * Deep copy semantic value to value of semantic analyzer, but only move VTYPE_LIST
+ * @param sem_an SemAnalyzer
+ * @param value semantic value
+ */
+static void sem_an_value_copy(SemAnalyzer* sem_an, const SemValue* value) {
+	if (value == NULL || !sem_value_copy_to(&sem_an->value_storage, value))
+		sem_an->value = NULL;
+	else
+		sem_an->value = &sem_an->value_storage;
+}
+
+SemValue* sem_value_init() {
+	return (SemValue*) mm_pool_malloc(sizeof(SemValue));
+}
+
+SemValue* sem_value_copy(const SemValue* value) {
+	if (value == NULL)
+		return NULL;
+
+	SemValue* new_val = (SemValue*) mm_pool_malloc(sizeof(SemValue));
+	if (!sem_value_copy_to(new_val, value)) {
+		mm_pool_free(new_val, sizeof(SemValue));
+		return NULL;
 	}
 
 	return new_val;
@@ -110,59 +171,96 @@ void sem_value_free(void* value) {
 	if (value == NULL)
 		return;
 
-	SemValue* to_free = (SemValue*) value;
-
-	switch (to_free->value_type) {
-		case VTYPE_TOKEN:
-			token_free(to_free->token);
-			break;
-		case VTYPE_ID:	// Can't free reference to symbol table
-			break;
-		case VTYPE_LIST:
-			dllist_free(to_free->list);
-			break;
-		case VTYPE_IF:
-			if (to_free->if_val.if_id != NULL)
-				mm_free(to_free->if_val.if_id);
-			if (to_free->if_val.elseif_id != NULL)
-				mm_free(to_free->if_val.elseif_id);
-			break;
-		case VTYPE_FOR:
-			mm_free(to_free->for_val.uid);
-			mm_free(to_free->for_val.step_id);
-			mm_free(to_free->for_val.endval_id);
-		default:
-			break;
-	}
-
-	mm_free(value);
+	sem_value_release((SemValue*) value);
+	mm_pool_free(value, sizeof(SemValue));
 }
 
 // ------------------------
 // SEMANTIC STACK FUNCTIONS
 // ------------------------
 
-bool sem_stack_empty(DLList *s) {
+SemStack* sem_stack_init() {
+	SemStack* s = (SemStack*) mm_malloc(sizeof(SemStack));
+	s->items = (SemAnalyzer*) mm_malloc(sizeof(SemAnalyzer) * SEM_STACK_INIT_SIZE);
+	s->size = 0;
+	s->capacity = SEM_STACK_INIT_SIZE;
+	s->search = 0;
+	s->func_def = 0;
+	s->for_loop = 0;
+
+	return s;
+}
+
+void sem_stack_free(SemStack* s) {
 	assert(s != NULL);
 
-	return dllist_empty(s);
+	for (unsigned i = 0; i < s->size; i++)
+		sem_an_free(&s->items[i]);
+	mm_free(s->items);
+	mm_free(s);
 }
 
-void* sem_stack_top(DLList *s) {
+bool sem_stack_empty(SemStack *s) {
 	assert(s != NULL);
 
-	return dllist_get_first(s);
+	return s->size == 0;
 }
 
-void* sem_stack_pop(DLList *s) {
+SemAnalyzer* sem_stack_top(SemStack *s) {
 	assert(s != NULL);
 
-	return dllist_delete_first(s);
+	if (s->size == 0)
+		return NULL;
+	return &s->items[s->size - 1];
 }
 
-void sem_stack_push(DLList *s, void* item) {
+SemAnalyzer* sem_stack_pop(SemStack *s) {
 	assert(s != NULL);
-	dllist_insert_first(s, item);
+
+	if (s->size == 0)
+		return NULL;
+
+	SemAnalyzer* sem_an = &s->items[--s->size];
+	// Restore context of enclosing analyzers
+	if (sem_an->sem_action == sem_func_def)
+		s->func_def = sem_an->context_prev;
+	else if (sem_an->sem_action == sem_for_loop)
+		s->for_loop = sem_an->context_prev;
+
+	return sem_an;
+}
+
+SemAnalyzer* sem_stack_push(SemStack *s, const SemAnalyzer* item) {
+	assert(s != NULL);
+	assert(item->value == NULL || item->value == &item->value_storage);
+
+	if (s->size == s->capacity) {
+		s->capacity *= 2;
+		s->items = (SemAnalyzer*) mm_realloc(s->items, sizeof(SemAnalyzer) * s->capacity);
+
+		// Values point to storage of analyzers, which were moved
+		for (unsigned i = 0; i < s->size; i++) {
+			if (s->items[i].value != NULL)
+				s->items[i].value = &s->items[i].value_storage;
+		}
+	}
+
+	SemAnalyzer* sem_an = &s->items[s->size++];
+	*sem_an = *item;
+	if (item->value != NULL)
+		sem_an->value = &sem_an->value_storage;
+
+	// Analyzers giving context to nested ones are chained, so they are found without searching
+	sem_an->context_prev = 0;
+	if (sem_an->sem_action == sem_func_def) {
+		sem_an->context_prev = s->func_def;
+		s->func_def = s->size;
+	} else if (sem_an->sem_action == sem_for_loop) {
+		sem_an->context_prev = s->for_loop;
+		s->for_loop = s->size;
+	}
+
+	return sem_an;
 }
 
 void sem_an_debug(void* sa) {
@@ -231,24 +329,31 @@ static HashTable* get_current_sym_tab(Parser* parser) {
 }
 
 /**
- * Find first matching semantic action on stack of semantic actions
+ * Get semantic analyzer of function definition the parser is in
  * @param parser Parser
- * @param sem_action Semantic action to find
- * @return SemAnalyzer with searched semantic action, NULL if not found
+ * @return topmost SemAnalyzer with sem_func_def, NULL if parser is not in function definition
  */
-static SemAnalyzer* find_sem_action(Parser *parser, semantic_action_f sem_action) {
-	dllist_activate_first(parser->sem_an_stack);
-	SemAnalyzer *sem_an;
+static SemAnalyzer* get_func_def(Parser *parser) {
+	SemStack* s = parser->sem_an_stack;
 
-	while (dllist_active(parser->sem_an_stack)) {
-		sem_an = (SemAnalyzer*) dllist_get_active(parser->sem_an_stack);
-		if (sem_an->sem_action == sem_action)
-			return sem_an;
+	if (s->func_def == 0)
+		return NULL;
+	return &s->items[s->func_def - 1];
+}
 
-		dllist_succ(parser->sem_an_stack);
-	}
+/**
+ * Get semantic analyzer of FOR loop enclosing given one (or the innermost one)
+ * @param parser Parser
+ * @param sem_an SemAnalyzer with sem_for_loop on stack, NULL to get the innermost FOR loop
+ * @return SemAnalyzer with sem_for_loop, NULL if there is no more FOR loops
+ */
+static SemAnalyzer* get_for_loop(Parser *parser, SemAnalyzer* sem_an) {
+	SemStack* s = parser->sem_an_stack;
+	unsigned index = sem_an == NULL ? s->for_loop : sem_an->context_prev;
 
-	return NULL;
+	if (index == 0)
+		return NULL;
+	return &s->items[index - 1];
 }
 
 /**
@@ -256,7 +361,7 @@ static SemAnalyzer* find_sem_action(Parser *parser, semantic_action_f sem_action
  * @param parser Parser
  */
 static void sem_action_search_activate(Parser* parser) {
-	dllist_activate_first(parser->sem_an_stack);
+	parser->sem_an_stack->search = parser->sem_an_stack->size;
 }
 
 /**
@@ -264,7 +369,7 @@ static void sem_action_search_activate(Parser* parser) {
  * @param parser
  */
 static void sem_action_search_end(Parser* parser) {
-	parser->sem_an_stack->active = NULL;
+	parser->sem_an_stack->search = 0;
 }
 
 /**
@@ -277,11 +382,10 @@ static void sem_action_search_end(Parser* parser) {
  * @return SemAnalyzer with searched semantic action, NULL if not found or searching was not activated
  */
 static SemAnalyzer* sem_action_search_next(Parser* parser, semantic_action_f sem_action) {
-	SemAnalyzer* sem_an;
+	SemStack* s = parser->sem_an_stack;
 
-	while (dllist_active(parser->sem_an_stack)) {
-		sem_an = (SemAnalyzer*) dllist_get_active(parser->sem_an_stack);
-		dllist_succ(parser->sem_an_stack);
+	while (s->search > 0) {
+		SemAnalyzer* sem_an = &s->items[--s->search];
 		if (sem_an->sem_action == sem_action) {
 			return sem_an;
 		}
@@ -317,6 +421,18 @@ static char* get_static_var_name(const char* func_name, const char* var_name) {
 	return static_id;
 }
 
+/**
+ * Find static variable of function in global symbol table without building its name
+ * @param parser Parser
+ * @param func_name Function name this variable is in
+ * @param var_name Variable name
+ * @return Found item in symbol table, NULL if not found
+ */
+static htab_item* find_static_var(Parser* parser, const char* func_name, const char* var_name) {
+	const char* parts[] = {"S", func_name, var_name};
+	return htab_find_atom(parser->sym_tab_global, intern_find_parts(parts, 3));
+}
+
 /**
  * Find symbol in symbol tables
  * (key in returned item is not same as searched key for static variables)
@@ -330,27 +446,22 @@ static htab_item* find_symbol(Parser* parser, const char* key) {
 	htab_item* item;
 
 	// If inside for loop with temporary iterator variable return it
-	sem_action_search_activate(parser);
-	sem_an = sem_action_search_next(parser, sem_for_loop);
+	sem_an = get_for_loop(parser, NULL);
 	while (sem_an != NULL) {
 		if (sem_an->value->value_type == VTYPE_FOR) {
-			char* for_iterator = concat(key, sem_an->value->for_val.uid);
-			item = htab_find(parser->sym_tab_global, for_iterator);
-			mm_free(for_iterator);
+			const char* parts[] = {key, sem_an->value->for_val.uid};
+			item = htab_find_atom(parser->sym_tab_global, intern_find_parts(parts, 2));
 			if (item != NULL) {
 				return item;
 			}
 		}
-		sem_an = sem_action_search_next(parser, sem_for_loop);
+		sem_an = get_for_loop(parser, sem_an);
 	}
-	sem_action_search_end(parser);
 
 	// Try to find static variable first
-	sem_an = find_sem_action(parser, sem_func_def);
+	sem_an = get_func_def(parser);
 	if (sem_an != NULL) {
-		char* static_id = get_static_var_name(sem_an->value->id->key, key);
-		item = htab_find(parser->sym_tab_global, static_id);
-		mm_free(static_id);
+		item = find_static_var(parser, sem_an->value->id->key, key);
 		if (item != NULL) {
 			return item;
 		}
@@ -378,11 +489,9 @@ static const char* get_var_scope_prefix(Parser* parser, const char* key) {
 	htab_item* item;
 
 	// Try to find static variable first
-	SemAnalyzer* sem_an = find_sem_action(parser, sem_func_def);
+	SemAnalyzer* sem_an = get_func_def(parser);
 	if (sem_an != NULL) {
-		char* static_id = get_static_var_name(sem_an->value->id->key, key);
-		item = htab_find(parser->sym_tab_global, static_id);
-		mm_free(static_id);
+		item = find_static_var(parser, sem_an->value->id->key, key);
 		if (item != NULL) {
 			return F_GLOBAL;
 		}
@@ -405,7 +514,7 @@ static const char* get_var_scope_prefix(Parser* parser, const char* key) {
  * @return new scope, NULL on error
  */
 static HashTable* create_scope(Parser* parser) {
-	HashTable* local = htab_init(HTAB_INIT_SIZE);
+	HashTable* local = htab_init_arena(HTAB_INIT_SIZE, parser->sym_tab_arena);
 
 	dllist_insert_first(parser->sym_tab_stack, local);
 
@@ -451,7 +560,7 @@ static DLList* get_current_il_list(Parser* parser) {
 	if (parser->il_override != NULL)
 		return parser->il_override;
 
-	if (find_sem_action(parser, sem_func_def) != NULL)
+	if (get_func_def(parser) != NULL)
 		return func_il;
 	if (dllist_get_first(parser->sym_tab_stack) != NULL)
 		return main_il;
@@ -459,7 +568,7 @@ static DLList* get_current_il_list(Parser* parser) {
 }
 
 
-static int def_var(Parser* parser, HashTable* symtab, const char* id, SemValue** value_out) {
+static int def_var(Parser* parser, HashTable* symtab, const char* id, SemAnalyzer* sem_an) {
 	HashTable* symtab_func = parser->sym_tab_functions;
 
 	// Check variable redefinition
@@ -473,10 +582,9 @@ static int def_var(Parser* parser, HashTable* symtab, const char* id, SemValue**
 	// Put variable in value table
 	htab_item* item = htab_var_insert(symtab, id);
 
-	*value_out = sem_value_init();
-
-	(*value_out)->value_type = VTYPE_ID;
-	(*value_out)->id = item;
+	SemValue* value = sem_an_value_init(sem_an);
+	value->value_type = VTYPE_ID;
+	value->id = item;
 
 	return EXIT_SUCCESS;
 }
@@ -517,7 +625,7 @@ int sem_expr_result(SemAnalyzer *sem_an, Parser *parser, SemValue value) {
 	SEM_FSM {
 		SEM_STATE(SEM_STATE_START) {
 			if (value.value_type == VTYPE_EXPR) {
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 
 				htab_item* item = htab_find(parser->sym_tab_global, EXPR_VALUE_VAR);
 				if (item == NULL) {
@@ -643,7 +751,7 @@ int sem_expr_and_or_not(SemAnalyzer *sem_an, Parser *parser, SemValue value) {
 			assert(value.value_type == VTYPE_TOKEN);
 
 			// Save operator
-			sem_an->value = sem_value_copy(&value);
+			sem_an_value_copy(sem_an, &value);
 
 			if (value.token->id == TOKEN_KW_NOT) {
 				DLList* il = get_current_il_list(parser);
@@ -712,7 +820,7 @@ int sem_expr_lte_gte(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 		SEM_STATE(SEM_STATE_OPERATOR) {
 			assert(value.value_type == VTYPE_TOKEN);
 
-			sem_an->value = sem_value_copy(&value);
+			sem_an_value_copy(sem_an, &value);
 
 			SEM_NEXT_STATE(SEM_STATE_OPERAND);
 		} END_STATE;
@@ -882,7 +990,7 @@ int sem_expr_eq_ne(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 		SEM_STATE(SEM_STATE_OPERATOR) {
 			assert(value.value_type == VTYPE_TOKEN);
 
-			sem_an->value = sem_value_copy(&value);
+			sem_an_value_copy(sem_an, &value);
 
 			SEM_NEXT_STATE(SEM_STATE_OPERAND);
 		} END_STATE;
@@ -972,7 +1080,7 @@ int sem_expr_aritmetic_basic(SemAnalyzer* sem_an, Parser* parser, SemValue value
 		SEM_STATE(SEM_STATE_OPERATOR) {
 			assert(value.value_type == VTYPE_TOKEN);
 
-			sem_an->value = sem_value_copy(&value);
+			sem_an_value_copy(sem_an, &value);
 
 			SEM_NEXT_STATE(SEM_STATE_OPERAND);
 		} END_STATE;
@@ -1090,7 +1198,7 @@ int sem_expr_div(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 		SEM_STATE(SEM_STATE_OPERATOR) {
 			assert(value.value_type == VTYPE_TOKEN);
 
-			sem_an->value = sem_value_copy(&value);
+			sem_an_value_copy(sem_an, &value);
 
 			SEM_NEXT_STATE(SEM_STATE_OPERAND);
 		} END_STATE;
@@ -1184,7 +1292,7 @@ int sem_expr_brackets(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 		SEM_STATE(SEM_STATE_START) {
 			if (value.value_type == VTYPE_EXPR) {
 				// Only copy the value for parent expression
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 				sem_an->finished = true;
 			}
 		} END_STATE;
@@ -1237,7 +1345,7 @@ int sem_expr_unary(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				// Substract
 				IL_ADD(il, OP_SUBS, NO_ADDR, NO_ADDR, NO_ADDR);
 
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 
 				sem_an->finished = true;
 			}
@@ -1256,7 +1364,7 @@ int sem_expr_list(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 	SEM_FSM {
 		SEM_STATE(SEM_STATE_START) {
 			if (value.value_type == VTYPE_EXPR) {
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 
 				sem_an->value->value_type = VTYPE_LIST;
 				sem_an->value->list = dllist_init(sem_value_free);
@@ -1302,7 +1410,7 @@ int sem_expr_list_expr(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 
 		SEM_STATE(SEM_STATE_LIST) {
 			if (value.value_type == VTYPE_LIST) {
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 
 				dllist_insert_last(sem_an->value->list, expr);
 
@@ -1323,7 +1431,7 @@ int sem_expr_func(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 		SEM_STATE(SEM_STATE_START) {
 			if (value.value_type == VTYPE_EXPR || value.value_type == VTYPE_LIST)
 			{
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 			} else if (value.value_type == VTYPE_TOKEN
 					&& value.token->id == TOKEN_LPAR)
 			{
@@ -1380,7 +1488,7 @@ int sem_expr_func(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 						addr_symbol("", func_item->key),
 						NO_ADDR, NO_ADDR);
 
-				sem_value_free(sem_an->value);
+				sem_an_free(sem_an);
 				SEM_SET_EXPR_TYPE(func_get_ret_type(func_item));
 
 				sem_an->finished = true;
@@ -1405,7 +1513,7 @@ int sem_expr_assign(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				if (id == NULL)
 					return EXIT_SEMANTIC_PROG_ERROR;
 
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 				sem_an->value->value_type = VTYPE_ID;
 				sem_an->value->id = id;
 
@@ -1604,7 +1712,7 @@ int sem_var_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 			if (value.value_type == VTYPE_TOKEN) {
 				if (value.token->id == TOKEN_KW_STATIC) {
 					// If we are not in function definition, treat it like normal variable
-					if (find_sem_action(parser, sem_func_def) == NULL) {
+					if (get_func_def(parser) == NULL) {
 						SEM_NEXT_STATE(SEM_STATE_VAR_ID);
 					} else {
 						SEM_NEXT_STATE(SEM_STATE_VAR_ID_STATIC);
@@ -1616,7 +1724,7 @@ int sem_var_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 
 					SEM_NEXT_STATE(SEM_STATE_VAR_ID_SHARED);
 				} else if (value.token->id == TOKEN_IDENTIFIER) {
-					int ret_val = def_var(parser, get_current_sym_tab(parser), value.token->data.str, &sem_an->value);
+					int ret_val = def_var(parser, get_current_sym_tab(parser), value.token->data.str, sem_an);
 					if (ret_val != EXIT_SUCCESS)
 						return ret_val;
 
@@ -1631,7 +1739,7 @@ int sem_var_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 
 		SEM_STATE(SEM_STATE_VAR_ID_SHARED) {
 			if (value.value_type == VTYPE_TOKEN && value.token->id == TOKEN_IDENTIFIER) {
-				int ret_val = def_var(parser, parser->sym_tab_global, value.token->data.str, &sem_an->value);
+				int ret_val = def_var(parser, parser->sym_tab_global, value.token->data.str, sem_an);
 				if (ret_val != EXIT_SUCCESS)
 					return ret_val;
 
@@ -1657,9 +1765,9 @@ int sem_var_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				}
 
 				// Static variables are global variables with function prefixes
-				char* static_id = get_static_var_name(find_sem_action(parser, sem_func_def)->value->id->key, value.token->data.str);
+				char* static_id = get_static_var_name(get_func_def(parser)->value->id->key, value.token->data.str);
 
-				int ret_val = def_var(parser, parser->sym_tab_global, static_id, &sem_an->value);
+				int ret_val = def_var(parser, parser->sym_tab_global, static_id, sem_an);
 				mm_free(static_id);
 				if (ret_val != EXIT_SUCCESS)
 					return ret_val;
@@ -1677,7 +1785,7 @@ int sem_var_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 
 		SEM_STATE(SEM_STATE_VAR_ID) {  // Only used for static variables outside of functions
 			if (value.value_type == VTYPE_TOKEN && value.token->id == TOKEN_IDENTIFIER) {
-				int ret_val = def_var(parser, get_current_sym_tab(parser), value.token->data.str, &sem_an->value);
+				int ret_val = def_var(parser, get_current_sym_tab(parser), value.token->data.str, sem_an);
 				if (ret_val != EXIT_SUCCESS)
 					return ret_val;
 
@@ -1809,7 +1917,7 @@ int sem_param_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 			if (value.value_type == VTYPE_TOKEN
 				&& value.token->id == TOKEN_IDENTIFIER)
 			{
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 
 				symtab_func = parser->sym_tab_functions;
 				symtab = get_current_sym_tab(parser);
@@ -1869,7 +1977,7 @@ int sem_func_decl(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 			if (value.value_type == VTYPE_TOKEN
 				&& value.token->id == TOKEN_IDENTIFIER)
 			{
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 
 				// Get symtable storing functions
 				symtab_func = parser->sym_tab_functions;
@@ -1961,7 +2069,7 @@ int sem_scope(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				value.token->id == TOKEN_KW_SCOPE)
 			{
 				// main scope statement encountered
-				if ((find_sem_action(parser, sem_func_def) == NULL)
+				if ((get_func_def(parser) == NULL)
 						&& (dllist_get_first(parser->sym_tab_stack) == NULL)) {
 					// check that every function have been defined
 					if (!func_check_all_defined(parser->sym_tab_functions))
@@ -2107,7 +2215,7 @@ int sem_func_def(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 					if (func_get_defined(item)) // Already defined
 						return EXIT_SEMANTIC_PROG_ERROR;
 					else {
-						sem_an->value = sem_value_init();
+						sem_an_value_init(sem_an);
 
 						sem_an->value->value_type = VTYPE_ID;
 						sem_an->value->id = item;
@@ -2134,7 +2242,7 @@ int sem_func_def(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				// Function was NOT declared -- add it to symtable
 				item = htab_func_insert(symtab_func, value.token->data.str);
 
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 
 				sem_an->value->value_type = VTYPE_ID;
 				sem_an->value->id = item;
@@ -2405,7 +2513,7 @@ int sem_do_loop(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 			{
 				create_scope(parser);
 
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 
 				// Generate id for condition
 				char* id = generate_uid();
@@ -2593,7 +2701,7 @@ int sem_for_loop(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 			if (value.value_type == VTYPE_TOKEN
 				&& value.token->id == TOKEN_IDENTIFIER)
 			{
-				sem_an->value = sem_value_copy(&value);
+				sem_an_value_copy(sem_an, &value);
 				SEM_NEXT_STATE(SEM_STATE_FOR_ITERATOR);
 			}
 		} END_STATE;
@@ -2620,8 +2728,8 @@ int sem_for_loop(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				char* end_id = concat(FOR_PREFIX_ENDVAL, uid);
 
 				// change SemValue to VTYPE_FOR
-				sem_value_free(sem_an->value);
-				sem_an->value = sem_value_init();
+				sem_an_free(sem_an);
+				sem_an_value_init(sem_an);
 				if (sem_an->value == NULL)
 					return EXIT_INTERN_ERROR;
 
@@ -2656,8 +2764,8 @@ int sem_for_loop(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 							return EXIT_INTERN_ERROR;
 						var_set_type(item, value.token->id);
 
-						sem_value_free(sem_an->value);
-						sem_an->value = sem_value_init();
+						sem_an_free(sem_an);
+						sem_an_value_init(sem_an);
 
 						// Save id to SemValue
 						sem_an->value->value_type = VTYPE_FOR;
@@ -2685,7 +2793,7 @@ int sem_for_loop(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 					return EXIT_SEMANTIC_COMP_ERROR;
 
 				ForValue for_val = sem_an->value->for_val;
-				char* key = for_val.iterator->key;
+				const char* key = for_val.iterator->key;
 
 				// Implicit conversion
 				if (var_get_type(value.id) == TOKEN_KW_DOUBLE
@@ -3077,13 +3185,15 @@ int sem_exit(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				sem_action_search_activate(parser);
 
 				// Prepare SemValue token to store last loop ID
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 				if (sem_an->value == NULL)
 					return EXIT_INTERN_ERROR;
 
 				sem_an->value->value_type = VTYPE_TOKEN;
 				sem_an->value->token = token_init();
 
+				// Loop ID is borrowed from loop semantic value
+				sem_an->value->token->borrowed = true;
 				sem_an->value->token->data.str = NULL;
 
 				SEM_NEXT_STATE(SEM_STATE_NEXT_LOOP_TYPE);
@@ -3148,12 +3258,14 @@ int sem_continue(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				sem_action_search_activate(parser);
 
 				// Prepare SemValue token to store last loop ID
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 				if (sem_an->value == NULL)
 					return EXIT_INTERN_ERROR;
 
 				sem_an->value->value_type = VTYPE_TOKEN;
 				sem_an->value->token = token_init();
+				// Loop ID is borrowed from loop semantic value
+				sem_an->value->token->borrowed = true;
 				sem_an->value->token->data.str = NULL;
 
 				SEM_NEXT_STATE(SEM_STATE_NEXT_LOOP_TYPE);
@@ -3211,7 +3323,7 @@ int sem_return(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 		SEM_STATE(SEM_STATE_START) {
 			if (value.value_type == VTYPE_ID)
 			{
-				sem_action = find_sem_action(parser, sem_func_def);
+				sem_action = get_func_def(parser);
 				if (sem_action == NULL)
 					return EXIT_SYNTAX_ERROR;
 
@@ -3261,7 +3373,7 @@ int sem_condition(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 				if (var_get_type(value.id) != TOKEN_KW_BOOLEAN)
 					return EXIT_SEMANTIC_COMP_ERROR;
 
-				sem_an->value = sem_value_init();
+				sem_an_value_init(sem_an);
 
 				// Generate id for if
 				char* id = generate_uid();
@@ -3310,7 +3422,7 @@ int sem_condition(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 						NO_ADDR, NO_ADDR);
 				IL_ADD_SPACE(il);
 				delete_scope(parser);
-				sem_value_free(sem_an->value);
+				sem_an_free(sem_an);
 				sem_an->value = NULL;
 				sem_an->finished = true;
 			}
@@ -3389,7 +3501,7 @@ int sem_condition(SemAnalyzer* sem_an, Parser* parser, SemValue value) {
 						NO_ADDR, NO_ADDR);
 				IL_ADD_SPACE(il);
 				delete_scope(parser);
-				sem_value_free(sem_an->value);
+				sem_an_free(sem_an);
 				sem_an->value = NULL;
 				sem_an->finished = true;
 			}
@@ -17,6 +17,8 @@
 
 #define EXPR_VALUE_VAR "EXPR_VALUE"
 
+#define SEM_STACK_INIT_SIZE 64  // Initial number of semantic analyzers on stack, stack grows twice when it is full
+
 /**
  * Enumeration of semantic states
  */
@@ -115,21 +117,37 @@ typedef struct sem_analyzer_t {
 	semantic_action_f sem_action;  /// Semantic action
 	bool finished;	/// Indicates whether semantic action is finished or not
 	sem_state_e state;	/// State of semantic action
-	SemValue* value;  /// Constant or temporary variable from nested SemAnalyzer or aggregated value for parent SymAnalyzer
+	SemValue* value;  /// Constant or temporary variable from nested SemAnalyzer or aggregated value for parent SymAnalyzer,
+					  /// NULL or value_storage
+	SemValue value_storage;  /// Storage of value, so analyzer does not allocate it
+	unsigned context_prev;  /// On stack, index + 1 of previous analyzer with the same context action
+							/// (sem_func_def or sem_for_loop), 0 if there is none
 } SemAnalyzer;
 
+/**
+ * Stack of semantic analyzers, array of analyzers with top at the end
+ */
+typedef struct sem_stack_t {
+	SemAnalyzer* items;  /// Semantic analyzers, bottom first
+	unsigned size;  /// Number of semantic analyzers
+	unsigned capacity;  /// Allocated number of semantic analyzers
+	unsigned search;  /// Number of analyzers (from bottom) not searched yet by searching from top
+	unsigned func_def;  /// Index + 1 of topmost sem_func_def analyzer (current function), 0 if there is none
+	unsigned for_loop;  /// Index + 1 of topmost sem_for_loop analyzer (chained by context_prev), 0 if there is none
+} SemStack;
+
 /**
  * Initialize semantic analyzer with sem_action and SEM_STATE_START state
+ * @param sem_an SemAnalyzer to initialize
  * @param sem_action Semantic action function
- * @return new SemAnalyzer object
  */
-SemAnalyzer* sem_an_init(semantic_action_f sem_action);
+void sem_an_init(SemAnalyzer* sem_an, semantic_action_f sem_action);
 
 /**
- * Free semantic action
+ * Free value of semantic analyzer, analyzer itself is not freed
  * @param sem_an SemAnalyzer
  */
-void sem_an_free(void* sem_an);
+void sem_an_free(SemAnalyzer* sem_an);
 
 /**
  * Initialize new semantic value
@@ -166,33 +184,47 @@ void sem_value_debug(void* val);
 // SEMANTIC STACK FUNCTIONS
 // ------------------------
 
+/**
+ * Allocate and initialize new semantic stack
+ * @return pointer to new stack
+ */
+SemStack* sem_stack_init();
+
+/**
+ * Free semantic stack and values of analyzers left on it
+ * @param s valid Stack object
+ */
+void sem_stack_free(SemStack* s);
+
 /**
  * Return whether stack is empty or not
  * @param s valid Stack object
  * @return true if empty, false otherwise
  */
-bool sem_stack_empty(DLList *s);
+bool sem_stack_empty(SemStack *s);
 
 /**
  * Return item on the top of the stack, does not remove it from the stack
  * @param s valid Stack object
  * @return item from top of the stack, NULL if stack is empty
  */
-void* sem_stack_top(DLList *s);
+SemAnalyzer* sem_stack_top(SemStack *s);
 
 /**
- * Return item on the top of the stack and remove it from the stack
+ * Return item on the top of the stack and remove it from the stack,
+ * item stays valid until next push, its value has to be freed by sem_an_free
  * @param s valid Stack object
  * @return item from top of the stack, NULL if stack is empty
  */
-void* sem_stack_pop(DLList *s);
+SemAnalyzer* sem_stack_pop(SemStack *s);
 
 /**
- * Push item to a top of the stack
+ * Push copy of item to a top of the stack, stack takes ownership of its value
  * @param s valid Stack object
  * @param item to push to stack
+ * @return item on the stack, valid until next push
  */
-void sem_stack_push(DLList *s, void* item);
+SemAnalyzer* sem_stack_push(SemStack *s, const SemAnalyzer* item);
 
 // ------------------
 // SEMANTIC FUNCTIONS
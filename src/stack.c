@@ -9,6 +9,7 @@
 
 #include <malloc.h>
 #include <assert.h>
+#include <string.h>
 #include "stack.h"
 #include "memory_manager.h"
 
@@ -102,3 +103,60 @@ void stack_debug(Stack* s, debug_func func) {
 
 	debugs("}\n\n");
 }
+
+SymbolStack* symbol_stack_init(unsigned default_size) {
+	assert(default_size > 0);
+
+	SymbolStack* s = (SymbolStack*) mm_malloc(sizeof(SymbolStack));
+	s->symbols = (uint16_t*) mm_malloc(sizeof(uint16_t) * default_size);
+	s->size = 0;
+	s->capacity = default_size;
+
+	return s;
+}
+
+/**
+ * Make space for given number of symbols on the top of the stack
+ * @param s valid SymbolStack object
+ * @param count number of symbols to be pushed
+ */
+static void symbol_stack_reserve(SymbolStack* s, unsigned count) {
+	if (s->size + count <= s->capacity)
+		return;
+
+	while (s->size + count > s->capacity)
+		s->capacity *= 2;
+	s->symbols = (uint16_t*) mm_realloc(s->symbols, sizeof(uint16_t) * s->capacity);
+}
+
+uint16_t symbol_stack_top(SymbolStack* s) {
+	assert(s != NULL && s->size > 0);
+	return s->symbols[s->size - 1];
+}
+
+uint16_t symbol_stack_pop(SymbolStack* s) {
+	assert(s != NULL && s->size > 0);
+	return s->symbols[--s->size];
+}
+
+void symbol_stack_push(SymbolStack* s, uint16_t symbol) {
+	assert(s != NULL);
+
+	symbol_stack_reserve(s, 1);
+	s->symbols[s->size++] = symbol;
+}
+
+void symbol_stack_push_n(SymbolStack* s, const uint16_t* symbols, unsigned count) {
+	assert(s != NULL);
+
+	symbol_stack_reserve(s, count);
+	memcpy(&s->symbols[s->size], symbols, sizeof(uint16_t) * count);
+	s->size += count;
+}
+
+void symbol_stack_free(SymbolStack* s) {
+	assert(s != NULL);
+
+	mm_free(s->symbols);
+	mm_free(s);
+}
@@ -12,6 +12,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "debug.h"
 
 #define STACK_CHUNK 10
@@ -29,6 +30,15 @@ typedef struct {
     void** stack;  /// Dynamically allocated pointer array
 } Stack;
 
+/**
+ * Stack of 16-bit symbols stored by value, it grows twice when it is full
+ */
+typedef struct {
+    uint16_t* symbols;  /// Dynamically allocated array of symbols, bottom first
+    unsigned size;  /// Number of symbols on the stack
+    unsigned capacity;  /// Stack allocated size
+} SymbolStack;
+
 
 /**
  * Allocate and initialize new stack
@@ -79,4 +89,46 @@ void stack_free(Stack* s, stack_free_callback free_item_f);
  */
 void stack_debug(Stack* s, debug_func func);
 
+/**
+ * Allocate and initialize new symbol stack
+ * @param default_size default stack allocation size, has to be greater than 0
+ * @return pointer to new stack
+ */
+SymbolStack* symbol_stack_init(unsigned default_size);
+
+/**
+ * Return symbol on the top of the stack, stack must not be empty
+ * @param s valid SymbolStack object
+ * @return symbol from top of the stack
+ */
+uint16_t symbol_stack_top(SymbolStack* s);
+
+/**
+ * Return symbol on the top of the stack and remove it from the stack, stack must not be empty
+ * @param s valid SymbolStack object
+ * @return symbol from top of the stack
+ */
+uint16_t symbol_stack_pop(SymbolStack* s);
+
+/**
+ * Push symbol to a top of the stack
+ * @param s valid SymbolStack object
+ * @param symbol symbol to push
+ */
+void symbol_stack_push(SymbolStack* s, uint16_t symbol);
+
+/**
+ * Push array of symbols at once, the last one ends on the top of the stack
+ * @param s valid SymbolStack object
+ * @param symbols symbols to push
+ * @param count number of symbols
+ */
+void symbol_stack_push_n(SymbolStack* s, const uint16_t* symbols, unsigned count);
+
+/**
+ * Free symbol stack
+ * @param s valid SymbolStack object
+ */
+void symbol_stack_free(SymbolStack* s);
+
 #endif //IFJ17_COMPILER_STACK_H
@@ -13,32 +13,135 @@
 #include <stdio.h>
 #include "symtable.h"
 #include "memory_manager.h"
+#include "intern.h"
 
 /**
- * Hash function djb2 (http://www.cse.yorku.ca/~oz/hash.html)
- * @param str String to convert into hash value
- * @return Hash value
+ * Allocate memory for hash table content
+ * @param htab Pointer to hash table
+ * @param size Number of bytes to allocate
+ * @return allocated memory
  */
-static unsigned long hash_func(const char *str) {
-	unsigned long hash = 5381;
-	int c;
-
-	while ((c = *str++))
-		hash = ((hash << 5) + hash) + c;
+static void* htab_alloc(HashTable* htab, size_t size) {
+	if (htab->arena == NULL)
+		return mm_malloc(size);
+	return mm_arena_alloc(htab->arena, size);
+}
 
-	return hash;
+/**
+ * Free memory allocated by htab_alloc
+ * @param htab Pointer to hash table
+ * @param ptr Allocated memory
+ */
+static void htab_dealloc(HashTable* htab, void* ptr) {
+	// Arena memory is released all at once by the owner of arena
+	if (htab->arena == NULL)
+		mm_free(ptr);
 }
 
 HashTable* htab_init(size_t bucket_count) {
-	HashTable* htab= (HashTable*) mm_malloc(sizeof(HashTable) + bucket_count*sizeof(htab_item*));
-	htab->bucket_count = bucket_count;
+	return htab_init_arena(bucket_count, NULL);
+}
 
-	for (size_t i = 0; i < bucket_count; i++)
-		htab->ptr[i] = NULL;
+/**
+ * Allocate array of empty slots
+ * @param htab Pointer to hash table
+ * @param size Number of slots
+ * @return array of slots
+ */
+static htab_slot* htab_alloc_slots(HashTable* htab, size_t size) {
+	htab_slot* slots = (htab_slot*) htab_alloc(htab, sizeof(htab_slot) * size);
+	for (size_t i = 0; i < size; i++)
+		slots[i].item = NULL;
+	return slots;
+}
+
+HashTable* htab_init_arena(size_t bucket_count, MemArena* arena) {
+	HashTable* htab = (HashTable*) (arena == NULL ? mm_malloc(sizeof(HashTable)) : mm_arena_alloc(arena, sizeof(HashTable)));
+	htab->arena = arena;
+	htab->size = HTAB_MIN_SIZE;
+	while (htab->size < bucket_count)
+		htab->size *= 2;
+	htab->count = 0;
+	htab->slots = htab_alloc_slots(htab, htab->size);
 
 	return htab;
 }
 
+/**
+ * Get distance of slot from home slot of its item
+ * @param htab Pointer to hash table
+ * @param index Index of slot
+ * @return number of slots item is displaced by
+ */
+static size_t htab_probe_distance(HashTable* htab, size_t index) {
+	return (index - (htab->slots[index].hash & (htab->size - 1))) & (htab->size - 1);
+}
+
+/**
+ * Put item to the table, item can not be in the table already
+ * @param htab Pointer to hash table
+ * @param slot Slot with item to put
+ */
+static void htab_put_slot(HashTable* htab, htab_slot slot) {
+	size_t index = slot.hash & (htab->size - 1);
+	size_t distance = 0;
+
+	while (htab->slots[index].item != NULL) {
+		// Item closer to its home slot gives its place to the inserted one
+		size_t existing = htab_probe_distance(htab, index);
+		if (existing < distance) {
+			htab_slot tmp = htab->slots[index];
+			htab->slots[index] = slot;
+			slot = tmp;
+			distance = existing;
+		}
+		index = (index + 1) & (htab->size - 1);
+		distance++;
+	}
+
+	htab->slots[index] = slot;
+}
+
+/**
+ * Double number of slots of hash table
+ * @param htab Pointer to hash table
+ */
+static void htab_grow(HashTable* htab) {
+	size_t old_size = htab->size;
+	htab_slot* old_slots = htab->slots;
+
+	htab->size *= 2;
+	htab->slots = htab_alloc_slots(htab, htab->size);
+	for (size_t i = 0; i < old_size; i++) {
+		if (old_slots[i].item != NULL)
+			htab_put_slot(htab, old_slots[i]);
+	}
+
+	htab_dealloc(htab, old_slots);
+}
+
+/**
+ * Find slot of item with given key
+ * @param htab Pointer to hash table
+ * @param atom Interned key
+ * @return index of slot, htab->size if item is not in the table
+ */
+static size_t htab_find_index(HashTable* htab, const char* atom) {
+	unsigned long hash = intern_hash(atom);
+	size_t index = hash & (htab->size - 1);
+
+	for (size_t distance = 0; htab->slots[index].item != NULL; distance++) {
+		if (htab->slots[index].hash == hash && htab->slots[index].item->key == atom)
+			return index;
+		// Item would have taken place of any item closer to its home slot
+		if (htab_probe_distance(htab, index) < distance)
+			break;
+		index = (index + 1) & (htab->size - 1);
+	}
+
+	return htab->size;
+}
+
 /**
  * Free all items from hash table
  * @param htab Pointer to hash table
@@ -46,23 +149,24 @@ HashTable* htab_init(size_t bucket_count) {
 static void htab_clear(HashTable *htab, bool func) {
 	if (htab == NULL)
 		return;
-	for (size_t i = 0; i < htab->bucket_count; i++) {
-		htab_item *prev;
-		htab_item *next;
-		for (prev = htab->ptr[i]; prev != NULL; prev = next) {
-			next = prev->next;
-			mm_free(prev->key);
-			if (func) {
-				buffer_free(prev->function->param_types);
-				buffer_free(prev->function->param_names);
-				mm_free(prev->function);
-			}
-			else
-				mm_free(prev->variable);
-			mm_free(prev);
+	// Nothing to release item by item
+	if (htab->arena != NULL && !func)
+		return;
+	for (size_t i = 0; i < htab->size; i++) {
+		htab_item* item = htab->slots[i].item;
+		if (item == NULL)
+			continue;
+		if (func) {
+			buffer_free(item->function->param_types);
+			buffer_free(item->function->param_names);
+			htab_dealloc(htab, item->function);
 		}
+		else
+			htab_dealloc(htab, item->variable);
+		htab_dealloc(htab, item);
 	}
-	mm_free(htab);
+	htab_dealloc(htab, htab->slots);
+	htab_dealloc(htab, htab);
 }
 
 void htab_var_free(void* htab) {
@@ -77,47 +181,53 @@ htab_item* htab_find(HashTable *htab, const char *key) {
 	if (htab == NULL || key == NULL)
 		return NULL;
 
-	unsigned long index = hash_func(key) % htab->bucket_count;
+	// Key which was never interned can not be in any table
+	return htab_find_atom(htab, intern_find(key));
+}
 
-	htab_item * item = htab->ptr[index];
-	while (item != NULL) {
-		if (strcmp(key, item->key) == 0)
-			return item;
-		else
-			item = item->next;
-	}
-	return NULL;
+htab_item* htab_find_atom(HashTable *htab, const char* atom) {
+	if (htab == NULL || atom == NULL)
+		return NULL;
+
+	size_t index = htab_find_index(htab, atom);
+	if (index == htab->size)
+		return NULL;
+	return htab->slots[index].item;
 }
 
 static bool htab_remove_item(HashTable *htab, const char *key, bool func) {
 	if (htab == NULL || key == NULL)
 		return false;
 
-	unsigned long index = hash_func(key) % htab->bucket_count;
+	const char* atom = intern_find(key);
+	if (atom == NULL)
+		return false;
 
-	htab_item ** item = &(htab->ptr[index]);
-	while (*item != NULL) {
-		if (strcmp(key, (*item)->key) == 0)
-			break;
-		item = &((*item)->next);
-	}
-	
-	if (*item == NULL)	// Item not found
+	size_t index = htab_find_index(htab, atom);
+	if (index == htab->size)	// Item not found
 		return false;
 
-	htab_item *tmp = *item;
-	*item = (*item)->next;
+	htab_item *tmp = htab->slots[index].item;
+
+	// Shift following displaced items one slot back
+	size_t next = (index + 1) & (htab->size - 1);
+	while (htab->slots[next].item != NULL && htab_probe_distance(htab, next) != 0) {
+		htab->slots[index] = htab->slots[next];
+		index = next;
+		next = (next + 1) & (htab->size - 1);
+	}
+	htab->slots[index].item = NULL;
+	htab->count--;
 
-	mm_free(tmp->key);
 	if (func) {
 		buffer_free(tmp->function->param_types);
 		buffer_free(tmp->function->param_names);
-		mm_free(tmp->function);
+		htab_dealloc(htab, tmp->function);
 	}
 	else
-		mm_free(tmp->variable);
+		htab_dealloc(htab, tmp->variable);
 
-	mm_free(tmp);
+	htab_dealloc(htab, tmp);
 	return true;
 }
 
@@ -131,10 +241,11 @@ bool htab_func_remove(HashTable* htab, const char *key) {
 
 /**
  * Alloc memory for function data stored in Hash Table item
+ * @param htab Pointer to hash table
  * @param item Hash table item
  */
-static void alloc_func_item(htab_item* item) {
-	item->function = (htab_function_item*) mm_malloc(sizeof(htab_function_item));
+static void alloc_func_item(HashTable* htab, htab_item* item) {
+	item->function = (htab_function_item*) htab_alloc(htab, sizeof(htab_function_item));
 	item->function->param_types = buffer_init(BUFFER_INIT_SIZE);
 	item->function->param_names = buffer_init(BUFFER_INIT_SIZE);
 	item->function->ret_type = END_OF_TERMINALS;
@@ -146,37 +257,31 @@ static htab_item * htab_add_item(HashTable *htab, const char *key, bool func) {
 	if (htab == NULL || key == NULL)
 		return NULL;
 
-	unsigned long index = hash_func(key) % htab->bucket_count;
-
-	// Item contains address of pointer to next item
-	htab_item ** item = &(htab->ptr[index]);
-	while (*item != NULL) {
-		if (strcmp(key, (*item)->key) == 0)
-			return *item;
-		else
-			item = &((*item)->next);
-	}
+	const char* atom = intern(key);
+	size_t index = htab_find_index(htab, atom);
+	if (index != htab->size)
+		return htab->slots[index].item;
 
 	// Allocate memory for new item
-	htab_item* new_item = (htab_item*) mm_malloc(sizeof(htab_item));
+	htab_item* new_item = (htab_item*) htab_alloc(htab, sizeof(htab_item));
 
-	// Alllocate memory for the key
-	size_t key_length = strlen(key) + 1;
-	new_item->key = (char*) mm_malloc(sizeof(char) * key_length);
-	strncpy(new_item->key, key, key_length); // Copy the key into the new item
+	new_item->key = atom;
 
 	// Allocate memory for item data
 	if (func)
-		alloc_func_item(new_item);
+		alloc_func_item(htab, new_item);
 	else {
-		new_item->variable = (htab_variable_item*) mm_malloc(sizeof(htab_variable_item));
+		new_item->variable = (htab_variable_item*) htab_alloc(htab, sizeof(htab_variable_item));
 		new_item->variable->type = END_OF_TERMINALS;
 	}
 
-	new_item->next = NULL;
+	// Keep load factor under HTAB_MAX_LOAD_NUM / HTAB_MAX_LOAD_DEN
+	if ((htab->count + 1) * HTAB_MAX_LOAD_DEN > htab->size * HTAB_MAX_LOAD_NUM)
+		htab_grow(htab);
 
-	// Put the new item at the end of the list of items
-	*item = new_item;
+	htab_slot slot = {intern_hash(atom), new_item};
+	htab_put_slot(htab, slot);
+	htab->count++;
 
 	return new_item;
 }
@@ -193,9 +298,10 @@ void htab_foreach(HashTable *htab, void (*function)(htab_item *item)) {
 	if (htab == NULL || function == NULL)
 		return;
 
-	for (size_t i = 0; i < htab->bucket_count; i++)
-		for (htab_item *item = htab->ptr[i]; item != NULL; item = item->next)
-			function(item);
+	for (size_t i = 0; i < htab->size; i++) {
+		if (htab->slots[i].item != NULL)
+			function(htab->slots[i].item);
+	}
 }
 
 void variable_item_debug(htab_item * item) {
@@ -351,11 +457,11 @@ bool func_get_defined(htab_item* item) {
 bool func_check_all_defined(HashTable *htab) {
 	assert(htab != NULL);
 
-	for (size_t i = 0; i < htab->bucket_count; i++)
-		for (htab_item *item = htab->ptr[i]; item != NULL; item = item->next) {
-			if (item->function->defined == false)
-				return false;
-		}
+	for (size_t i = 0; i < htab->size; i++) {
+		htab_item *item = htab->slots[i].item;
+		if (item != NULL && item->function->defined == false)
+			return false;
+	}
 	return true;
 }
 
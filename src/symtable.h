@@ -15,9 +15,13 @@
 #include "token.h"
 #include "dllist.h"
 #include "buffer.h"
+#include "memory_manager.h"
 
 #define BUFFER_INIT_SIZE 42
-#define HTAB_INIT_SIZE 67
+#define HTAB_INIT_SIZE 32  // Rounded up to power of two
+#define HTAB_MIN_SIZE 8
+#define HTAB_MAX_LOAD_NUM 3  // Table grows when more than 3/4 of slots are used
+#define HTAB_MAX_LOAD_DEN 4
 
 /**
  * Function hash table item
@@ -38,29 +42,51 @@ typedef struct htab_variable_item_t {
  * Identifier hash table item
  */
 typedef struct htab_item_t {
-	char *key;	/// Identifier
-	struct htab_item_t * next;	/// Pointer to next item in the list
+	const char *key;	/// Identifier, interned so keys can be compared by pointers
 	union {
 		htab_function_item* function;
 		htab_variable_item* variable;
 	};
 } htab_item;
 
+/**
+ * Hash table slot
+ */
+typedef struct htab_slot_t {
+	unsigned long hash;	/// Hash of item key
+	htab_item* item;	/// Item, NULL if slot is empty
+} htab_slot;
+
 /**
  * Hash Table structure
+ *
+ * Open addressing with Robin Hood linear probing, items are kept sorted by distance
+ * from their home slot, so lookup can stop early and removal shifts following items back
+ * instead of leaving tombstones. Items are allocated separately, so their addresses do not
+ * change when the table grows.
  */
 typedef struct hash_table {
-	size_t bucket_count;	/// Number of buckets contained in the hash table
-	htab_item *ptr[];	/// Array(of size 'bucket_count') of buckets
+	MemArena* arena;	/// Arena holding table and its items, NULL if they are allocated by mm_malloc
+	size_t size;	/// Number of slots (power of two)
+	size_t count;	/// Number of items in the table
+	htab_slot* slots;	/// Array(of size 'size') of slots
 } HashTable;
 
 /**
  * Initialize empty hash table
- * @param bucket_count Size of array of buckets
+ * @param bucket_count Initial number of slots, the table grows as items are inserted
  * @return Pointer to empty hash table
  */
 HashTable *htab_init(size_t bucket_count);
 
+/**
+ * Initialize empty hash table allocated from given arena, items are released with the arena
+ * @param bucket_count Initial number of slots, the table grows as items are inserted
+ * @param arena Memory arena
+ * @return Pointer to empty hash table
+ */
+HashTable *htab_init_arena(size_t bucket_count, MemArena* arena);
+
 /**
  * Free hash table
  * @param htab Pointer to hash table
@@ -76,6 +102,14 @@ void htab_func_free(HashTable *htab);
  */
 htab_item * htab_find(HashTable *htab, const char* key);
 
+/**
+ * Find item by interned key, skips interning of the key
+ * @param htab Pointer to hash table
+ * @param atom Interned string identifying an item (can be NULL)
+ * @return Pointer to item or NULL if the item does not exist
+ */
+htab_item * htab_find_atom(HashTable *htab, const char* atom);
+
 /**
  * Remove bucket containing given key
  * @param htab Pointer to hash table
@@ -16,17 +16,22 @@
 #include "memory_manager.h"
 
 Token* token_init() {
-	return (Token*) mm_malloc(sizeof(Token));
+	Token* token = (Token*) mm_pool_malloc(sizeof(Token));
+	token->id = END_OF_TERMINALS;
+	token->borrowed = false;
+	token->data.str = NULL;
+
+	return token;
 }
 
 void token_free(Token* token) {
 	if (token == NULL)
 		return;
 
-	if (token->id == TOKEN_IDENTIFIER || token->id == TOKEN_STRING)
+	if ((token->id == TOKEN_IDENTIFIER || token->id == TOKEN_STRING) && !token->borrowed)
 		if (token->data.str != NULL)
 			mm_free(token->data.str);
-	mm_free(token);
+	mm_pool_free(token, sizeof(Token));
 }
 
 unsigned int get_token_column_value(token_e token) {
@@ -39,10 +44,15 @@ Token* token_copy(Token* token) {
 
 	Token* copy = token_init();
 	copy->id = token->id;
+	copy->borrowed = token->borrowed;
 
 	switch (token->id) {
 		case TOKEN_STRING:
 		case TOKEN_IDENTIFIER:
+			if (token->borrowed) {
+				copy->data.str = token->data.str;
+				break;
+			}
 			copy->data.str = (char*) mm_malloc(sizeof(char) * (strlen(token->data.str) + 1));
 			strcpy(copy->data.str, token->data.str);
 			break;
@@ -62,6 +72,7 @@ Token* token_copy(Token* token) {
 Token token_make(token_e type, union token_data data) {
 	Token token;
 	token.id = type;
+	token.borrowed = false;
 	token.data = data;
 	return token;
 }
@@ -69,6 +80,7 @@ Token token_make(token_e type, union token_data data) {
 Token token_make_str(const char* string) {
 	Token token;
 	token.id = TOKEN_STRING;
+	token.borrowed = false;
 	char* copy = (char*) mm_malloc(sizeof(char) * (strlen(string) + 1));
 
 	strcpy(copy, string);
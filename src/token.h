@@ -10,6 +10,7 @@
 #ifndef IFJ17_COMPILER_TOKEN_H
 #define IFJ17_COMPILER_TOKEN_H
 
+#include <stdbool.h>
 #include "grammar.h"
 
 #define IS_TOKEN(expr) ((expr) >= TERMINALS_START && (expr) < END_OF_TERMINALS)
@@ -113,6 +114,7 @@ union token_data {
  */
 typedef struct token_t {
     token_e id;		/// Type of token
+    bool borrowed;  /// Token does not own data.str, string lives as long as its owner (e.g. scanner)
     union token_data data;  /// Token data
 } Token;
 
@@ -123,7 +125,7 @@ typedef struct token_t {
 Token* token_init();
 
 /**
- * Free token
+ * Free token, string is freed only if it is owned by the token
  * @param token
  */
 void token_free(Token* token);
@@ -136,7 +138,7 @@ void token_free(Token* token);
 unsigned int get_token_column_value(token_e token);
 
 /**
- * Deep copy a token
+ * Copy a token, string of borrowed token is shared, otherwise it is copied
  * @param token Token to copy
  * @return copied token
  */
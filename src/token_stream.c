@@ -0,0 +1,67 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+#include <assert.h>
+#include "token_stream.h"
+
+TokenStream* token_stream_init() {
+	TokenStream* stream = (TokenStream*) mm_malloc(sizeof(TokenStream));
+
+	stream->size = TOKEN_STREAM_INIT_SIZE;
+	stream->count = 0;
+	stream->ids = (token_e*) mm_malloc(sizeof(token_e) * stream->size);
+	stream->data = (union token_data*) mm_malloc(sizeof(union token_data) * stream->size);
+	stream->lines = (unsigned*) mm_malloc(sizeof(unsigned) * stream->size);
+	stream->columns = (unsigned*) mm_malloc(sizeof(unsigned) * stream->size);
+	stream->strings = mm_arena_create(TOKEN_STREAM_POOL_CHUNK_SIZE);
+
+	return stream;
+}
+
+void token_stream_free(TokenStream* stream) {
+	assert(stream != NULL);
+
+	mm_free(stream->ids);
+	mm_free(stream->data);
+	mm_free(stream->lines);
+	mm_free(stream->columns);
+	mm_arena_destroy(stream->strings);
+	mm_free(stream);
+}
+
+void token_stream_append(TokenStream* stream, const Token* token, unsigned line, unsigned column) {
+	assert(stream != NULL);
+	assert(token != NULL);
+
+	if (stream->count == stream->size) {
+		stream->size *= 2;
+		stream->ids = (token_e*) mm_realloc(stream->ids, sizeof(token_e) * stream->size);
+		stream->data = (union token_data*) mm_realloc(stream->data, sizeof(union token_data) * stream->size);
+		stream->lines = (unsigned*) mm_realloc(stream->lines, sizeof(unsigned) * stream->size);
+		stream->columns = (unsigned*) mm_realloc(stream->columns, sizeof(unsigned) * stream->size);
+	}
+
+	stream->ids[stream->count] = token->id;
+	stream->data[stream->count] = token->data;
+	stream->lines[stream->count] = line;
+	stream->columns[stream->count] = column;
+	stream->count++;
+}
+
+Token token_stream_get(const TokenStream* stream, size_t index) {
+	assert(stream != NULL);
+	assert(index < stream->count);
+
+	Token token;
+	token.id = stream->ids[index];
+	token.borrowed = true;
+	token.data = stream->data[index];
+
+	return token;
+}
@@ -0,0 +1,62 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+#ifndef IFJ17_COMPILER_TOKEN_STREAM_H
+#define IFJ17_COMPILER_TOKEN_STREAM_H
+
+#include <stddef.h>
+#include "token.h"
+#include "memory_manager.h"
+
+#define TOKEN_STREAM_INIT_SIZE 1024
+#define TOKEN_STREAM_POOL_CHUNK_SIZE 65536
+
+/**
+ * Tokens of whole input stored as structure of arrays
+ */
+typedef struct {
+	token_e* ids;  /// Token ids
+	union token_data* data;  /// Token data
+	unsigned* lines;  /// Line numbers of tokens
+	unsigned* columns;  /// Columns of tokens (offsets of their first characters from line start)
+	size_t count;  /// Number of tokens
+	size_t size;  /// Allocated size of arrays
+	MemArena* strings;  /// String pool for strings of string tokens (identifiers are interned)
+} TokenStream;
+
+/**
+ * Allocate new empty token stream
+ * @return new TokenStream
+ */
+TokenStream* token_stream_init();
+
+/**
+ * Free token stream with its string pool
+ * @param stream TokenStream
+ */
+void token_stream_free(TokenStream* stream);
+
+/**
+ * Append token to the end of stream, token string has to live in string pool or be interned
+ * @param stream TokenStream
+ * @param token Token to append (its content is copied)
+ * @param line Line number of token
+ * @param column Column of token
+ */
+void token_stream_append(TokenStream* stream, const Token* token, unsigned line, unsigned column);
+
+/**
+ * Get token at index
+ * @param stream TokenStream
+ * @param index Index of token, has to be less than count
+ * @return token, its string is borrowed from the stream
+ */
+Token token_stream_get(const TokenStream* stream, size_t index);
+
+#endif //IFJ17_COMPILER_TOKEN_STREAM_H
@@ -83,3 +83,33 @@ TEST_F(BufferDataTestFixture, BufferClear) {
 			(unsigned) 0
 	) << "Length should be zero\n";
 }
+
+TEST_F(BufferDataTestFixture, BufferClearKeepsCapacity) {
+	buffer_append_str(buffer, "very_long_identifier_to_make_buffer_grow");
+	size_t size = buffer->buffer_size;
+
+	buffer_clear(buffer);
+
+	EXPECT_EQ(buffer->buffer_size, size) << "Capacity should be kept\n";
+	EXPECT_STREQ(buffer->str, "") << "Buffer should be empty\n";
+}
+
+TEST_F(BufferDataTestFixture, AppendN) {
+	buffer_append_str(buffer, "str");
+	buffer_append_n(buffer, "_to_append_and_ignore", 10);
+
+	EXPECT_STREQ(buffer->str, "str_to_append") << "Buffer should contain inserted text\n";
+	EXPECT_EQ(buffer->len, (unsigned) 13) << "Length should match\n";
+}
+
+TEST_F(BufferDataTestFixture, Reserve) {
+	buffer_reserve(buffer, 1000);
+	char* str = buffer->str;
+
+	for (int i = 0; i < 1000; i++) {
+		buffer_append_c(buffer, 'a');
+	}
+
+	EXPECT_EQ(buffer->str, str) << "Buffer should not be reallocated\n";
+	EXPECT_EQ(buffer->len, (unsigned) 1000) << "Length should match\n";
+}
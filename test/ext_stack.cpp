@@ -10,13 +10,11 @@ protected:
 
 	virtual void SetUp() {
 		mem_manager_init();
-		expr_grammar_init();
 		s = ext_stack_init();
 	}
 
 	virtual void TearDown() {
 		ext_stack_free(s);
-		expr_grammar_free();
 		mem_manager_free();
 	}
 };
@@ -52,3 +50,54 @@ TEST_F(ExtendedStackTestFixture, PushAndTop) {
 	ext_stack_push(s, NT_LIST, NULL);
 	EXPECT_EQ(ext_stack_top(s), push_items[i]);
 }
+
+TEST_F(ExtendedStackTestFixture, ShiftAndTop) {
+	Token token = token_make(TOKEN_ADD, {0});
+
+	ext_stack_push(s, NT_EXPRESSION, NULL);
+	EXPECT_EQ(ext_stack_top(s), EXPR_END_MARKER);
+
+	ext_stack_shift(s, &token);
+	EXPECT_EQ(ext_stack_top(s), TOKEN_ADD);
+
+	// Handle starts at the expression right above '$'
+	ASSERT_EQ(s->handles_size, 1u);
+	EXPECT_EQ(s->handles[0], 1u);
+	EXPECT_EQ(s->size, 3u);
+
+	ext_stack_push(s, NT_EXPRESSION, NULL);
+	EXPECT_EQ(ext_stack_top(s), TOKEN_ADD);
+}
+
+TEST(ExprGrammarTest, PrecedenceTable) {
+	EXPECT_EQ(PT_GET(EXPR_END_MARKER, TOKEN_EOL), EXPR_SUCCESS);
+	EXPECT_EQ(PT_GET(EXPR_END_MARKER, TOKEN_INT), EXPR_HANDLE_MARKER);
+	EXPECT_EQ(PT_GET(TOKEN_ADD, TOKEN_MUL), EXPR_HANDLE_MARKER);
+	EXPECT_EQ(PT_GET(TOKEN_MUL, TOKEN_ADD), EXPR_REDUCE_MARKER);
+	EXPECT_EQ(PT_GET(TOKEN_DIVI, TOKEN_DIVI), EXPR_REDUCE_MARKER);
+	EXPECT_EQ(PT_GET(TOKEN_IDENTIFIER, TOKEN_LPAR), EXPR_PUSH_MARKER);
+	EXPECT_EQ(PT_GET(TOKEN_KW_TRUE, TOKEN_STRING), EXPR_ERROR);
+	EXPECT_EQ(PT_GET(TOKEN_LPAR, TOKEN_KW_THEN), EXPR_ERROR);
+
+	// Tokens which are not part of expression behave like end marker
+	for (unsigned top = TERMINALS_START; top < TERMINALS_START + PT_SYMBOLS; top++) {
+		EXPECT_EQ(PT_GET(top, TOKEN_KW_THEN), PT_GET(top, EXPR_END_MARKER)) << "Top " << top;
+	}
+}
+
+TEST(ExprGrammarTest, ReductionTrie) {
+	for (unsigned i = 0; i < NUM_OF_EXPR_RULES; i++) {
+		unsigned node = 0;
+		for (unsigned k = 0; expr_grammar.rules[i].production[k] != END_OF_RULE; k++) {
+			node = EXPR_TRIE_NEXT(node, expr_grammar.rules[i].production[k]);
+			ASSERT_NE(node, 0u) << "Rule " << i;
+		}
+		EXPECT_EQ(expr_grammar.trie_rules[node], i);
+	}
+
+	// Prefix of production is not a rule
+	unsigned node = EXPR_TRIE_NEXT(0, TOKEN_RPAR);
+	ASSERT_NE(node, 0u);
+	EXPECT_EQ(expr_grammar.trie_rules[node], (unsigned) EXPR_TRIE_NO_RULE);
+	EXPECT_EQ(EXPR_TRIE_NEXT(0, TOKEN_ADD), 0u);
+}
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+#include "intern.c"
+
+class InternTestFixture : public ::testing::Test {
+protected:
+	virtual void SetUp() {
+		mem_manager_init();
+	}
+
+	virtual void TearDown() {
+		mem_manager_free();
+	}
+};
+
+TEST_F(InternTestFixture, SameStringSameAtom) {
+	char str[] = "identifier";
+	const char* atom = intern(str);
+
+	EXPECT_STREQ(atom, "identifier");
+	EXPECT_NE(atom, str) << "Atom has to be a copy";
+	EXPECT_EQ(intern("identifier"), atom);
+	EXPECT_EQ(intern_n("identifier_2", 10), atom);
+	EXPECT_NE(intern("identifier_2"), atom);
+	EXPECT_EQ(intern_len(atom), 10u);
+}
+
+TEST_F(InternTestFixture, Find) {
+	EXPECT_EQ(intern_find("abc"), nullptr);
+
+	const char* atom = intern("abc");
+	EXPECT_EQ(intern_find("abc"), atom);
+	EXPECT_EQ(intern_find("ab"), nullptr);
+}
+
+TEST_F(InternTestFixture, FindParts) {
+	const char* parts[] = {"S", "func", "var"};
+	EXPECT_EQ(intern_find_parts(parts, 3), nullptr);
+
+	const char* atom = intern("Sfuncvar");
+	EXPECT_EQ(intern_find_parts(parts, 3), atom);
+	EXPECT_EQ(intern_find_parts(parts, 2), nullptr);
+
+	const char* split[] = {"Sfu", "", "ncvar"};
+	EXPECT_EQ(intern_find_parts(split, 3), atom);
+}
+
+TEST_F(InternTestFixture, Hash) {
+	const char* atom = intern("func_name");
+
+	unsigned long hash = intern_hash_n(INTERN_HASH_INIT, "func", 4);
+	hash = intern_hash_n(hash, "_name", 5);
+	EXPECT_EQ(intern_hash(atom), hash) << "Hash has to be computable by parts";
+}
+
+TEST_F(InternTestFixture, Grow) {
+	const char* atoms[INTERN_INIT_SIZE * 2];
+	char str[32];
+
+	for (int i = 0; i < INTERN_INIT_SIZE * 2; i++) {
+		sprintf(str, "id%d", i);
+		atoms[i] = intern(str);
+	}
+
+	for (int i = 0; i < INTERN_INIT_SIZE * 2; i++) {
+		sprintf(str, "id%d", i);
+		EXPECT_EQ(intern_find(str), atoms[i]);
+		EXPECT_STREQ(atoms[i], str);
+	}
+}
+
+TEST_F(InternTestFixture, ResetOnMemoryManagerFree) {
+	intern("abc");
+	mem_manager_free();
+	mem_manager_init();
+
+	EXPECT_EQ(intern_find("abc"), nullptr);
+	EXPECT_STREQ(intern("abc"), "abc");
+}
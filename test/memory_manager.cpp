@@ -7,6 +7,7 @@
  * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
  */
 
+#include <thread>
 #include "gtest/gtest.h"
 #include "memory_manager.c"
 
@@ -125,3 +126,106 @@ TEST(MemoryManagerTest, Realloc) {
 
 	mem_manager_free();
 }
+
+TEST(MemoryManagerTest, FreeOutOfOrderAfterRealloc) {
+	mem_manager_init();
+
+	int* arr[10];
+
+	for (int i = 0; i < 10; i++) {
+		arr[i] = (int*) mm_malloc(sizeof(int));
+		*arr[i] = i;
+	}
+
+	arr[3] = (int*) mm_realloc(arr[3], sizeof(int) * 100);
+	EXPECT_EQ(*arr[3], 3);
+
+	for (int i = 0; i < 10; i += 2) {
+		mm_free(arr[i]);
+	}
+	EXPECT_EQ(mm.first_free, (unsigned) 5);
+
+	for (int i = 9; i > 0; i -= 2) {
+		EXPECT_EQ(*arr[i], i);
+		mm_free(arr[i]);
+	}
+	EXPECT_EQ(mm.first_free, (unsigned) 0);
+
+	mem_manager_free();
+}
+
+TEST(MemoryManagerTest, Arena) {
+	mem_manager_init();
+
+	MemArena* arena = mm_arena_create(64);
+	EXPECT_EQ(mm.first_free, (unsigned) 1);
+
+	auto small = (int*) mm_arena_alloc(arena, sizeof(int));
+	*small = 42;
+	auto big = (char*) mm_arena_alloc(arena, 1000);
+	big[999] = 'x';
+	EXPECT_EQ(mm.first_free, (unsigned) 3);
+	EXPECT_EQ(*small, 42);
+	EXPECT_EQ(((size_t) big) % sizeof(BlockHeader), (size_t) 0);
+
+	mm_arena_reset(arena);
+	EXPECT_EQ(mm.first_free, (unsigned) 2);
+	mm_arena_alloc(arena, sizeof(int));
+	EXPECT_EQ(mm.first_free, (unsigned) 2);
+
+	mm_arena_destroy(arena);
+	EXPECT_EQ(mm.first_free, (unsigned) 0);
+
+	mem_manager_free();
+}
+
+TEST(MemoryManagerTest, Pool) {
+	mem_manager_init();
+
+	auto first = (double*) mm_pool_malloc(sizeof(double));
+	auto second = (double*) mm_pool_malloc(sizeof(double));
+	EXPECT_NE(first, second);
+	EXPECT_EQ(pools[POOL_CLASS(sizeof(double))].misses, (unsigned) 2);
+
+	mm_pool_free(first, sizeof(double));
+	auto third = (double*) mm_pool_malloc(sizeof(double));
+	EXPECT_EQ(first, third);
+	EXPECT_EQ(pools[POOL_CLASS(sizeof(double))].hits, (unsigned) 1);
+
+	// Big objects are not pooled
+	unsigned blocks = mm.first_free;
+	auto big = mm_pool_malloc(POOL_MAX_SIZE + 1);
+	EXPECT_EQ(mm.first_free, blocks + 1);
+	mm_pool_free(big, POOL_MAX_SIZE + 1);
+	EXPECT_EQ(mm.first_free, blocks);
+
+	mem_manager_free();
+}
+
+TEST(MemoryManagerTest, Threaded) {
+	mem_manager_init();
+	mem_manager_set_threaded(true);
+
+	auto work = []() {
+		MemArena* arena = mm_arena_create(64);
+		for (int i = 0; i < 1000; i++) {
+			auto ptr = (int*) mm_malloc(sizeof(int));
+			ptr = (int*) mm_realloc(ptr, sizeof(int) * 2);
+			ptr[1] = i;
+			mm_arena_alloc(arena, 32);
+			mm_free(ptr);
+		}
+		mm_arena_destroy(arena);
+	};
+
+	std::thread threads[4];
+	for (auto &thread : threads)
+		thread = std::thread(work);
+	for (auto &thread : threads)
+		thread.join();
+
+	mem_manager_set_threaded(false);
+	EXPECT_EQ(mm.first_free, (unsigned) 0);
+
+	mem_manager_free();
+}
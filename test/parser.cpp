@@ -14,7 +14,7 @@
 #include "sem_analyzer.c"
 #include "utils.c"
 
-class ParserTestFixture : public ::testing::Test {
+class ParserTestFixture : public ::testing::TestWithParam<bool> {
 protected:
 
 	Scanner* scanner;
@@ -25,6 +25,7 @@ protected:
 		mem_manager_init();
 		scanner = scanner_init();
 		parser = parser_init(scanner);
+		parser->batch_lexing = GetParam();
 	}
 
 	virtual void TearDown() {
@@ -44,6 +45,8 @@ protected:
 	}
 };
 
+INSTANTIATE_TEST_SUITE_P(BatchLexing, ParserTestFixture, ::testing::Bool());
+
 TEST(UIDGeneratorTest, UIDS200) {
 	mem_manager_init();
 	constexpr int n = 500;
@@ -62,85 +65,173 @@ TEST(UIDGeneratorTest, UIDS200) {
 	mem_manager_free();
 }
 
-TEST_F(ParserTestFixture, SuccEmpty) {
+TEST(SemStackTest, ValuesSurviveGrowth) {
+	mem_manager_init();
+	SemStack* s = sem_stack_init();
+
+	for (int i = 0; i < 3 * SEM_STACK_INIT_SIZE; i++) {
+		SemAnalyzer sem_an;
+		sem_an_init(&sem_an, sem_expr_const);
+		if (i % 2 == 0) {
+			SemValue* value = sem_an_value_init(&sem_an);
+			value->value_type = VTYPE_EXPR;
+			value->expr_type = i;
+		}
+		SemAnalyzer* pushed = sem_stack_push(s, &sem_an);
+		EXPECT_EQ(pushed, sem_stack_top(s));
+	}
+
+	for (int i = 3 * SEM_STACK_INIT_SIZE - 1; i >= 0; i--) {
+		SemAnalyzer* sem_an = sem_stack_pop(s);
+		ASSERT_NE(sem_an, nullptr);
+		EXPECT_EQ(sem_an->sem_action, sem_expr_const);
+		if (i % 2 == 0) {
+			ASSERT_EQ(sem_an->value, &sem_an->value_storage);
+			EXPECT_EQ(sem_an->value->expr_type, i);
+		} else {
+			EXPECT_EQ(sem_an->value, nullptr);
+		}
+		sem_an_free(sem_an);
+	}
+	EXPECT_TRUE(sem_stack_empty(s));
+	EXPECT_EQ(sem_stack_pop(s), nullptr);
+
+	sem_stack_free(s);
+	mem_manager_free();
+}
+
+TEST(SemStackTest, ContextChains) {
+	mem_manager_init();
+	SemStack* s = sem_stack_init();
+	semantic_action_f actions[] = {sem_func_def, sem_for_loop, sem_expr_const, sem_for_loop, sem_for_loop};
+
+	for (unsigned i = 0; i < sizeof(actions) / sizeof(actions[0]); i++) {
+		SemAnalyzer sem_an;
+		sem_an_init(&sem_an, actions[i]);
+		sem_stack_push(s, &sem_an);
+	}
+	EXPECT_EQ(s->func_def, 1u);
+	EXPECT_EQ(s->for_loop, 5u);
+	EXPECT_EQ(s->items[4].context_prev, 4u);
+	EXPECT_EQ(s->items[3].context_prev, 2u);
+	EXPECT_EQ(s->items[1].context_prev, 0u);
+
+	// Popping restores context of enclosing analyzers
+	sem_stack_pop(s);
+	EXPECT_EQ(s->for_loop, 4u);
+	sem_stack_pop(s);
+	sem_stack_pop(s);
+	EXPECT_EQ(s->for_loop, 2u);
+	sem_stack_pop(s);
+	EXPECT_EQ(s->for_loop, 0u);
+	EXPECT_EQ(s->func_def, 1u);
+	sem_stack_pop(s);
+	EXPECT_EQ(s->func_def, 0u);
+
+	sem_stack_free(s);
+	mem_manager_free();
+}
+
+TEST(GrammarTest, LLTableRulesMatchRows) {
+	bool used[NUM_OF_RULES] = {false};
+
+	for (unsigned nt = 0; nt < NT_ENUM_SIZE; nt++) {
+		for (unsigned column = 0; column < LL_TABLE_COLUMNS; column++) {
+			unsigned rule_idx = LL_TABLE_GET(nt, column);
+			ASSERT_LT(rule_idx, (unsigned) NUM_OF_RULES);
+			if (rule_idx != 0) {
+				ASSERT_NE(grammar.rules[rule_idx].production, nullptr);
+				EXPECT_EQ((unsigned) grammar.rules[rule_idx].for_nt, nt) << "Rule " << rule_idx;
+				used[rule_idx] = true;
+			}
+		}
+	}
+
+	// Every generated rule can be applied
+	for (unsigned rule_idx = 1; rule_idx < NUM_OF_RULES; rule_idx++) {
+		EXPECT_TRUE(used[rule_idx]) << "Rule " << rule_idx;
+	}
+}
+
+TEST_P(ParserTestFixture, SuccEmpty) {
 	SetInputFile("test_files/empty.fbc");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFactorialIt) {
+TEST_P(ParserTestFixture, SuccFactorialIt) {
 	SetInputFile("test_files/factorial_it.fbc");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFactorialRecur) {
+TEST_P(ParserTestFixture, SuccFactorialRecur) {
 	SetInputFile("test_files/factorial_recur.fbc");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccStrings) {
+TEST_P(ParserTestFixture, SuccStrings) {
 	SetInputFile("test_files/strings.fbc");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic02) {
+TEST_P(ParserTestFixture, SuccBasic02) {
 	SetInputFile("test_files/syntax/basic/02.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic03) {
+TEST_P(ParserTestFixture, SuccBasic03) {
 	SetInputFile("test_files/syntax/basic/03.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic05) {
+TEST_P(ParserTestFixture, SuccBasic05) {
 	SetInputFile("test_files/syntax/basic/05.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic06) {
+TEST_P(ParserTestFixture, SuccBasic06) {
 	SetInputFile("test_files/syntax/basic/06.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic08) {
+TEST_P(ParserTestFixture, SuccBasic08) {
 	SetInputFile("test_files/syntax/basic/08.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic09) {
+TEST_P(ParserTestFixture, SuccBasic09) {
 	SetInputFile("test_files/syntax/basic/09.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic10) {
+TEST_P(ParserTestFixture, SuccBasic10) {
 	SetInputFile("test_files/syntax/basic/10.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic18) {
+TEST_P(ParserTestFixture, SuccBasic18) {
 	SetInputFile("test_files/syntax/basic/18.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic19) {
+TEST_P(ParserTestFixture, SuccBasic19) {
 	SetInputFile("test_files/syntax/basic/19.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBasic20) {
+TEST_P(ParserTestFixture, SuccBasic20) {
 	SetInputFile("test_files/syntax/basic/20_modified.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
@@ -150,163 +241,163 @@ TEST_F(ParserTestFixture, SuccBasic20) {
 // FUNCTIONS
 // --------
 
-TEST_F(ParserTestFixture, SuccFunctions01) {
+TEST_P(ParserTestFixture, SuccFunctions01) {
 	SetInputFile("test_files/syntax/functions/01.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions02) {
+TEST_P(ParserTestFixture, SuccFunctions02) {
 	SetInputFile("test_files/syntax/functions/02.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions03) {
+TEST_P(ParserTestFixture, SuccFunctions03) {
 	SetInputFile("test_files/syntax/functions/03.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_PROG_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions04) {
+TEST_P(ParserTestFixture, SuccFunctions04) {
 	SetInputFile("test_files/syntax/functions/04.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions05) {
+TEST_P(ParserTestFixture, SuccFunctions05) {
 	SetInputFile("test_files/syntax/functions/05.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions06) {
+TEST_P(ParserTestFixture, SuccFunctions06) {
 	SetInputFile("test_files/syntax/functions/06.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_PROG_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions07) {
+TEST_P(ParserTestFixture, SuccFunctions07) {
 	SetInputFile("test_files/syntax/functions/07.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_PROG_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions08) {
+TEST_P(ParserTestFixture, SuccFunctions08) {
 	SetInputFile("test_files/syntax/functions/08.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions09) {
+TEST_P(ParserTestFixture, SuccFunctions09) {
 	SetInputFile("test_files/syntax/functions/09.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions10) {
+TEST_P(ParserTestFixture, SuccFunctions10) {
 	SetInputFile("test_files/syntax/functions/10.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions11) {
+TEST_P(ParserTestFixture, SuccFunctions11) {
 	SetInputFile("test_files/syntax/functions/11.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions12) {
+TEST_P(ParserTestFixture, SuccFunctions12) {
 	SetInputFile("test_files/syntax/functions/12.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions13) {
+TEST_P(ParserTestFixture, SuccFunctions13) {
 	SetInputFile("test_files/syntax/functions/13.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions14) {
+TEST_P(ParserTestFixture, SuccFunctions14) {
 	SetInputFile("test_files/syntax/functions/14.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions15) {
+TEST_P(ParserTestFixture, SuccFunctions15) {
 	SetInputFile("test_files/syntax/functions/15.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions16) {
+TEST_P(ParserTestFixture, SuccFunctions16) {
 	SetInputFile("test_files/syntax/functions/16.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions17) {
+TEST_P(ParserTestFixture, SuccFunctions17) {
 	SetInputFile("test_files/syntax/functions/17.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions18) {
+TEST_P(ParserTestFixture, SuccFunctions18) {
 	SetInputFile("test_files/syntax/functions/18.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions19) {
+TEST_P(ParserTestFixture, SuccFunctions19) {
 	SetInputFile("test_files/syntax/functions/19.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions20) {
+TEST_P(ParserTestFixture, SuccFunctions20) {
 	SetInputFile("test_files/syntax/functions/20.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions21) {
+TEST_P(ParserTestFixture, SuccFunctions21) {
 	SetInputFile("test_files/syntax/functions/21.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions22) {
+TEST_P(ParserTestFixture, SuccFunctions22) {
 	SetInputFile("test_files/syntax/functions/22.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions23) {
+TEST_P(ParserTestFixture, SuccFunctions23) {
 	SetInputFile("test_files/syntax/functions/23.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_COMP_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions24) {
+TEST_P(ParserTestFixture, SuccFunctions24) {
 	SetInputFile("test_files/syntax/functions/24.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_COMP_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions26) {
+TEST_P(ParserTestFixture, SuccFunctions26) {
 	SetInputFile("test_files/syntax/functions/26.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions27) {
+TEST_P(ParserTestFixture, SuccFunctions27) {
 	SetInputFile("test_files/syntax/functions/27.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_COMP_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccFunctions28) {
+TEST_P(ParserTestFixture, SuccFunctions28) {
 	SetInputFile("test_files/syntax/functions/28.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
@@ -316,13 +407,13 @@ TEST_F(ParserTestFixture, SuccFunctions28) {
 // GLOBAL
 // ------
 
-TEST_F(ParserTestFixture, SuccGlobalSimple01) {
+TEST_P(ParserTestFixture, SuccGlobalSimple01) {
 	SetInputFile("test_files/syntax/global/simple_01.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccGlobalSimple02) {
+TEST_P(ParserTestFixture, SuccGlobalSimple02) {
 	SetInputFile("test_files/syntax/global/simple_02.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
@@ -332,13 +423,13 @@ TEST_F(ParserTestFixture, SuccGlobalSimple02) {
 // STATEMENTS
 // ----------
 
-TEST_F(ParserTestFixture, SuccStatements06) {
+TEST_P(ParserTestFixture, SuccStatements06) {
 	SetInputFile("test_files/syntax/statements/06_modified.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccStatements07) {
+TEST_P(ParserTestFixture, SuccStatements07) {
 	SetInputFile("test_files/syntax/statements/07.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
@@ -348,67 +439,67 @@ TEST_F(ParserTestFixture, SuccStatements07) {
 // BASE
 // ----
 
-TEST_F(ParserTestFixture, SuccBase01) {
+TEST_P(ParserTestFixture, SuccBase01) {
 	SetInputFile("test_files/syntax/base/01.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBase02) {
+TEST_P(ParserTestFixture, SuccBase02) {
 	SetInputFile("test_files/syntax/base/02.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBase03) {
+TEST_P(ParserTestFixture, SuccBase03) {
 	SetInputFile("test_files/syntax/base/03.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBase04) {
+TEST_P(ParserTestFixture, SuccBase04) {
 	SetInputFile("test_files/syntax/base/04.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBase05) {
+TEST_P(ParserTestFixture, SuccBase05) {
 	SetInputFile("test_files/syntax/base/05.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBase06) {
+TEST_P(ParserTestFixture, SuccBase06) {
 	SetInputFile("test_files/syntax/base/06.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccBase07) {
+TEST_P(ParserTestFixture, SuccBase07) {
 	SetInputFile("test_files/syntax/base/07.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccBase08) {
+TEST_P(ParserTestFixture, SuccBase08) {
 	SetInputFile("test_files/syntax/base/08.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccBase09) {
+TEST_P(ParserTestFixture, SuccBase09) {
 	SetInputFile("test_files/syntax/base/09.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccBase10) {
+TEST_P(ParserTestFixture, SuccBase10) {
 	SetInputFile("test_files/syntax/base/10.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccBase11) {
+TEST_P(ParserTestFixture, SuccBase11) {
 	SetInputFile("test_files/syntax/base/11.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
@@ -417,103 +508,103 @@ TEST_F(ParserTestFixture, SuccBase11) {
 // LOOPS
 // -----
 
-TEST_F(ParserTestFixture, SuccLoops01) {
+TEST_P(ParserTestFixture, SuccLoops01) {
 	SetInputFile("test_files/syntax/loops/01.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops02) {
+TEST_P(ParserTestFixture, SuccLoops02) {
 	SetInputFile("test_files/syntax/loops/02.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops03) {
+TEST_P(ParserTestFixture, SuccLoops03) {
 	SetInputFile("test_files/syntax/loops/03.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops04) {
+TEST_P(ParserTestFixture, SuccLoops04) {
 	SetInputFile("test_files/syntax/loops/04.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops05) {
+TEST_P(ParserTestFixture, SuccLoops05) {
 	SetInputFile("test_files/syntax/loops/05.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops06) {
+TEST_P(ParserTestFixture, SuccLoops06) {
 	SetInputFile("test_files/syntax/loops/06.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops18) {
+TEST_P(ParserTestFixture, SuccLoops18) {
 	SetInputFile("test_files/syntax/loops/18.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccLoops19) {
+TEST_P(ParserTestFixture, SuccLoops19) {
 	SetInputFile("test_files/syntax/loops/19.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops20) {
+TEST_P(ParserTestFixture, SuccLoops20) {
 	SetInputFile("test_files/syntax/loops/20.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_OTHER_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops21) {
+TEST_P(ParserTestFixture, SuccLoops21) {
 	SetInputFile("test_files/syntax/loops/21.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops22) {
+TEST_P(ParserTestFixture, SuccLoops22) {
 	SetInputFile("test_files/syntax/loops/22.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops23) {
+TEST_P(ParserTestFixture, SuccLoops23) {
 	SetInputFile("test_files/syntax/loops/23.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_OTHER_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops24) {
+TEST_P(ParserTestFixture, SuccLoops24) {
 	SetInputFile("test_files/syntax/loops/24.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_PROG_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops25) {
+TEST_P(ParserTestFixture, SuccLoops25) {
 	SetInputFile("test_files/syntax/loops/25.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_COMP_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops26) {
+TEST_P(ParserTestFixture, SuccLoops26) {
 	SetInputFile("test_files/syntax/loops/26.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_COMP_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops27) {
+TEST_P(ParserTestFixture, SuccLoops27) {
 	SetInputFile("test_files/syntax/loops/27.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_COMP_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccLoops28) {
+TEST_P(ParserTestFixture, SuccLoops28) {
 	SetInputFile("test_files/syntax/loops/28.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SYNTAX_ERROR);
@@ -523,85 +614,85 @@ TEST_F(ParserTestFixture, SuccLoops28) {
 // CONDITIONS
 // ----------
 
-TEST_F(ParserTestFixture, SuccConditions01) {
+TEST_P(ParserTestFixture, SuccConditions01) {
 	SetInputFile("test_files/syntax/conditions/01.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions02) {
+TEST_P(ParserTestFixture, SuccConditions02) {
 	SetInputFile("test_files/syntax/conditions/02.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions03) {
+TEST_P(ParserTestFixture, SuccConditions03) {
 	SetInputFile("test_files/syntax/conditions/03.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions04) {
+TEST_P(ParserTestFixture, SuccConditions04) {
 	SetInputFile("test_files/syntax/conditions/04.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions05) {
+TEST_P(ParserTestFixture, SuccConditions05) {
 	SetInputFile("test_files/syntax/conditions/05.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions06) {
+TEST_P(ParserTestFixture, SuccConditions06) {
 	SetInputFile("test_files/syntax/conditions/06.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions07) {
+TEST_P(ParserTestFixture, SuccConditions07) {
 	SetInputFile("test_files/syntax/conditions/07.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions08) {
+TEST_P(ParserTestFixture, SuccConditions08) {
 	SetInputFile("test_files/syntax/conditions/08.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions09) {
+TEST_P(ParserTestFixture, SuccConditions09) {
 	SetInputFile("test_files/syntax/conditions/09.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions10) {
+TEST_P(ParserTestFixture, SuccConditions10) {
 	SetInputFile("test_files/syntax/conditions/10.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions11) {
+TEST_P(ParserTestFixture, SuccConditions11) {
 	SetInputFile("test_files/syntax/conditions/11.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SEMANTIC_PROG_ERROR);
 }
 
-TEST_F(ParserTestFixture, SuccConditions12) {
+TEST_P(ParserTestFixture, SuccConditions12) {
 	SetInputFile("test_files/syntax/conditions/12.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions13) {
+TEST_P(ParserTestFixture, SuccConditions13) {
 	SetInputFile("test_files/syntax/conditions/13.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
 }
 
-TEST_F(ParserTestFixture, SuccConditions14) {
+TEST_P(ParserTestFixture, SuccConditions14) {
 	SetInputFile("test_files/syntax/conditions/14.code");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
@@ -611,7 +702,7 @@ TEST_F(ParserTestFixture, SuccConditions14) {
 // EXPR
 // ----
 
-TEST_F(ParserTestFixture, SuccSimpleExpr01) {
+TEST_P(ParserTestFixture, SuccSimpleExpr01) {
 	SetInputFile("test_files/simple_expr_01.fbc");
 
 	EXPECT_EQ(parse(parser), EXIT_SUCCESS);
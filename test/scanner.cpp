@@ -12,7 +12,7 @@
 #include "scanner.c"
 #include "token.c"
 
-class ScannerTestFixture : public ::testing::Test {
+class ScannerTestFixture : public ::testing::TestWithParam<scanner_engine_e> {
 protected:
 
     Scanner* scanner;
@@ -21,6 +21,7 @@ protected:
 	virtual void SetUp() {
 		mem_manager_init();
 		scanner = scanner_init();
+		scanner->engine = GetParam();
 	}
 
 	virtual void TearDown() {
@@ -39,7 +40,9 @@ protected:
 	}
 };
 
-TEST_F(ScannerTestFixture, EmptyFile) {
+INSTANTIATE_TEST_SUITE_P(Engines, ScannerTestFixture, ::testing::Values(SCANNER_ENGINE_FSM, SCANNER_ENGINE_DFA));
+
+TEST_P(ScannerTestFixture, EmptyFile) {
 	SetInputFile("test_files/empty.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -53,7 +56,7 @@ TEST_F(ScannerTestFixture, EmptyFile) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrBase01) {
+TEST_P(ScannerTestFixture, ErrBase01) {
 	SetInputFile("test_files/scanner/lex_err_base_01.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -67,7 +70,7 @@ TEST_F(ScannerTestFixture, ErrBase01) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrBase02) {
+TEST_P(ScannerTestFixture, ErrBase02) {
 	SetInputFile("test_files/scanner/lex_err_base_02.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -81,7 +84,7 @@ TEST_F(ScannerTestFixture, ErrBase02) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrBase03) {
+TEST_P(ScannerTestFixture, ErrBase03) {
 	SetInputFile("test_files/scanner/lex_err_base_03.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -95,7 +98,7 @@ TEST_F(ScannerTestFixture, ErrBase03) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrBase04) {
+TEST_P(ScannerTestFixture, ErrBase04) {
 	SetInputFile("test_files/scanner/lex_err_base_04.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -109,7 +112,7 @@ TEST_F(ScannerTestFixture, ErrBase04) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrBlockComm01) {
+TEST_P(ScannerTestFixture, ErrBlockComm01) {
 	SetInputFile("test_files/scanner/lex_err_block_comment_01.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -123,7 +126,7 @@ TEST_F(ScannerTestFixture, ErrBlockComm01) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrBlockComm02) {
+TEST_P(ScannerTestFixture, ErrBlockComm02) {
 	SetInputFile("test_files/scanner/lex_err_block_comment_02.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -137,7 +140,7 @@ TEST_F(ScannerTestFixture, ErrBlockComm02) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrReal01) {
+TEST_P(ScannerTestFixture, ErrReal01) {
 	SetInputFile("test_files/scanner/lex_err_real_01.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -151,7 +154,7 @@ TEST_F(ScannerTestFixture, ErrReal01) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrReal02) {
+TEST_P(ScannerTestFixture, ErrReal02) {
 	SetInputFile("test_files/scanner/lex_err_real_02.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -165,7 +168,7 @@ TEST_F(ScannerTestFixture, ErrReal02) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrReal03) {
+TEST_P(ScannerTestFixture, ErrReal03) {
 	SetInputFile("test_files/scanner/lex_err_real_03.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -179,7 +182,7 @@ TEST_F(ScannerTestFixture, ErrReal03) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrReal04) {
+TEST_P(ScannerTestFixture, ErrReal04) {
 	SetInputFile("test_files/scanner/lex_err_real_04.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -193,7 +196,7 @@ TEST_F(ScannerTestFixture, ErrReal04) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrReal05) {
+TEST_P(ScannerTestFixture, ErrReal05) {
 	SetInputFile("test_files/scanner/lex_err_real_05.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -207,7 +210,7 @@ TEST_F(ScannerTestFixture, ErrReal05) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrString01) {
+TEST_P(ScannerTestFixture, ErrString01) {
 	SetInputFile("test_files/scanner/lex_err_string_01.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -221,7 +224,7 @@ TEST_F(ScannerTestFixture, ErrString01) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrString02) {
+TEST_P(ScannerTestFixture, ErrString02) {
 	SetInputFile("test_files/scanner/lex_err_string_02.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -235,7 +238,7 @@ TEST_F(ScannerTestFixture, ErrString02) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrString03) {
+TEST_P(ScannerTestFixture, ErrString03) {
 	SetInputFile("test_files/scanner/lex_err_string_03.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -249,7 +252,7 @@ TEST_F(ScannerTestFixture, ErrString03) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrString04) {
+TEST_P(ScannerTestFixture, ErrString04) {
 	SetInputFile("test_files/scanner/lex_err_string_04.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -263,7 +266,7 @@ TEST_F(ScannerTestFixture, ErrString04) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrString05) {
+TEST_P(ScannerTestFixture, ErrString05) {
 	SetInputFile("test_files/scanner/lex_err_string_05.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -277,7 +280,7 @@ TEST_F(ScannerTestFixture, ErrString05) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrString06) {
+TEST_P(ScannerTestFixture, ErrString06) {
 	SetInputFile("test_files/scanner/lex_err_string_06.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -291,7 +294,7 @@ TEST_F(ScannerTestFixture, ErrString06) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ErrUnknownChar) {
+TEST_P(ScannerTestFixture, ErrUnknownChar) {
 	SetInputFile("test_files/scanner/lex_err_unknown_char.fbc");
 
 	Token *token = scanner_get_token(scanner);
@@ -305,7 +308,7 @@ TEST_F(ScannerTestFixture, ErrUnknownChar) {
 	token_free(token);
 }
 
-TEST_F(ScannerTestFixture, ParseInteger) {
+TEST_P(ScannerTestFixture, ParseInteger) {
 	SetInputFile("test_files/scanner/parse_int.fbc");
 
 	// 0
@@ -357,7 +360,7 @@ TEST_F(ScannerTestFixture, ParseInteger) {
 	ASSERT_EQ(token->id, TOKEN_EOF);
 }
 
-TEST_F(ScannerTestFixture, ParseReal) {
+TEST_P(ScannerTestFixture, ParseReal) {
 	SetInputFile("test_files/scanner/parse_real.fbc");
 
 	// 5e-5
@@ -437,7 +440,7 @@ TEST_F(ScannerTestFixture, ParseReal) {
 	ASSERT_EQ(token->id, TOKEN_EOF);
 }
 
-TEST_F(ScannerTestFixture, ParseString) {
+TEST_P(ScannerTestFixture, ParseString) {
 	SetInputFile("test_files/scanner/parse_string.fbc");
 
 	// "Test string \001\n"
@@ -475,7 +478,7 @@ TEST_F(ScannerTestFixture, ParseString) {
 	ASSERT_EQ(token->id, TOKEN_EOF);
 }
 
-TEST_F(ScannerTestFixture, EmptyStringConcat) {
+TEST_P(ScannerTestFixture, EmptyStringConcat) {
 	SetInputFile("test_files/scanner/empty_string.fbc");
 
 	// length
@@ -519,7 +522,208 @@ TEST_F(ScannerTestFixture, EmptyStringConcat) {
 	ASSERT_EQ(token->id, TOKEN_EOF);
 }
 
-TEST_F(ScannerTestFixture, Basic02) {
+TEST_P(ScannerTestFixture, BorrowedLexeme) {
+	SetInputFile("test_files/scanner/empty_string.fbc");
+
+	Token *token = scanner_get_token(scanner);
+
+	ASSERT_NE(token, nullptr);
+	ASSERT_EQ(token->id, TOKEN_IDENTIFIER);
+	EXPECT_TRUE(token->borrowed);
+
+	Token *copy = token_copy(token);
+	EXPECT_EQ(copy->data.str, token->data.str) << "Borrowed string should not be copied";
+	token_free(token);
+	EXPECT_STREQ(copy->data.str, "length");
+	token_free(copy);
+}
+
+TEST_P(ScannerTestFixture, Keywords) {
+	SetInputFile("test_files/scanner/keywords.fbc");
+
+	token_e keywords[] = {
+		TOKEN_KW_AS, TOKEN_KW_DECLARE, TOKEN_KW_DIM, TOKEN_KW_DO, TOKEN_KW_DOUBLE, TOKEN_KW_ELSE, TOKEN_KW_END,
+		TOKEN_KW_FUNCTION, TOKEN_KW_IF, TOKEN_KW_INPUT, TOKEN_KW_INTEGER, TOKEN_KW_LOOP, TOKEN_KW_PRINT,
+		TOKEN_KW_RETURN, TOKEN_KW_SCOPE, TOKEN_KW_STRING, TOKEN_KW_THEN, TOKEN_KW_WHILE, TOKEN_KW_UNTIL, TOKEN_EOL,
+		TOKEN_KW_AND, TOKEN_KW_BOOLEAN, TOKEN_KW_CONTINUE, TOKEN_KW_ELSEIF, TOKEN_KW_EXIT, TOKEN_KW_FALSE,
+		TOKEN_KW_FOR, TOKEN_KW_NEXT, TOKEN_KW_NOT, TOKEN_KW_OR, TOKEN_KW_SHARED, TOKEN_KW_STATIC, TOKEN_KW_TRUE,
+		TOKEN_KW_TO, TOKEN_KW_STEP, TOKEN_EOL
+	};
+
+	Token* token;
+	for (unsigned int i = 0; i < sizeof(keywords) / sizeof(token_e); i++) {
+		token = scanner_get_token(scanner);
+		ASSERT_NE(token, nullptr) << "Iter: " << i;
+		ASSERT_EQ(token->id, keywords[i]) << "Iter: " << i;
+		token_free(token);
+	}
+
+	const char* identifiers[] = {"asx", "doo", "_if", "if_", "i2f", "continue1", "e"};
+
+	for (unsigned int i = 0; i < sizeof(identifiers) / sizeof(char*); i++) {
+		token = scanner_get_token(scanner);
+		ASSERT_NE(token, nullptr) << "Iter: " << i;
+		ASSERT_EQ(token->id, TOKEN_IDENTIFIER) << "Iter: " << i;
+		EXPECT_STREQ(token->data.str, identifiers[i]) << "Iter: " << i;
+		token_free(token);
+	}
+}
+
+TEST_P(ScannerTestFixture, PeekAndAdvance) {
+	SetInputFile("test_files/syntax/basic/02.code");
+
+	// EOL Scope EOL Dim a As ...
+	Token* token = scanner_peek(scanner, 5);
+	ASSERT_NE(token, nullptr);
+	EXPECT_EQ(token->id, TOKEN_KW_AS);
+	EXPECT_EQ(scanner_peek(scanner, 0)->id, TOKEN_EOL);
+	EXPECT_EQ(scanner_peek(scanner, 1)->id, TOKEN_KW_SCOPE);
+	EXPECT_EQ(scanner_peek(scanner, 1), scanner_peek(scanner, 1)) << "Peek should not read new token";
+
+	scanner_advance(scanner);
+	scanner_advance(scanner);
+	scanner_advance(scanner);
+	EXPECT_EQ(scanner_peek(scanner, 2), token);
+	ASSERT_EQ(scanner_peek(scanner, 1)->id, TOKEN_IDENTIFIER);
+	EXPECT_STREQ(scanner_peek(scanner, 1)->data.str, "a");
+
+	// Wrap around ring
+	token_e tokens[] = {
+		TOKEN_KW_DIM, TOKEN_IDENTIFIER, TOKEN_KW_AS, TOKEN_KW_STRING, TOKEN_EOL,
+		TOKEN_KW_DIM, TOKEN_IDENTIFIER, TOKEN_KW_AS, TOKEN_KW_INTEGER, TOKEN_EOL,
+		TOKEN_KW_DIM, TOKEN_IDENTIFIER, TOKEN_KW_AS, TOKEN_KW_DOUBLE, TOKEN_EOL,
+		TOKEN_KW_END, TOKEN_KW_SCOPE, TOKEN_EOF
+	};
+
+	for (unsigned int i = 0; i < sizeof(tokens) / sizeof(token_e); i++) {
+		if (i + SCANNER_RING_SIZE - 1 < sizeof(tokens) / sizeof(token_e)) {
+			EXPECT_EQ(scanner_peek(scanner, SCANNER_RING_SIZE - 1)->id, tokens[i + SCANNER_RING_SIZE - 1]) << "Iter: " << i;
+		}
+		ASSERT_EQ(scanner_peek(scanner, 0)->id, tokens[i]) << "Iter: " << i;
+		scanner_advance(scanner);
+	}
+}
+
+TEST_P(ScannerTestFixture, Tokenize) {
+	SetInputFile("test_files/scanner/simple01.fbc");
+
+	TokenStream* stream = token_stream_init();
+	scanner_tokenize(scanner, stream);
+
+	// Compare with tokens read one by one
+	FILE* file = fopen("test_files/scanner/simple01.fbc", "r");
+	ASSERT_NE(file, nullptr);
+	Scanner* reference = scanner_init();
+	reference->engine = GetParam();
+	reference->stream = file;
+
+	for (size_t i = 0; i < stream->count; i++) {
+		unsigned line = reference->line;
+		Token* expected = scanner_peek(reference, 0);
+		Token token = token_stream_get(stream, i);
+
+		ASSERT_EQ(token.id, expected->id) << "Iter: " << i;
+		EXPECT_EQ(stream->lines[i], line) << "Iter: " << i;
+		if (token.id == TOKEN_IDENTIFIER || token.id == TOKEN_STRING) {
+			EXPECT_STREQ(token.data.str, expected->data.str) << "Iter: " << i;
+		}
+		scanner_advance(reference);
+	}
+	EXPECT_EQ(stream->ids[stream->count - 1], TOKEN_EOF);
+
+	scanner_free(reference);
+	fclose(file);
+	token_stream_free(stream);
+}
+
+TEST_P(ScannerTestFixture, LineOffsets) {
+	SetInputFile("test_files/scanner/chunks.fbc");
+
+	TokenStream* stream = token_stream_init();
+	scanner_tokenize(scanner, stream);
+
+	// Scope ' Comment
+	EXPECT_EQ(stream->ids[0], TOKEN_KW_SCOPE);
+	EXPECT_EQ(stream->columns[0], 0u);
+	EXPECT_EQ(stream->ids[1], TOKEN_EOL);
+	EXPECT_EQ(stream->columns[1], 6u);
+	EXPECT_EQ(stream->lines[1], 1u);
+
+	// Dim a As Integer = 10 /' block comment ... '/ Dim B As String
+	EXPECT_EQ(stream->ids[2], TOKEN_KW_DIM);
+	EXPECT_EQ(stream->lines[2], 2u);
+	EXPECT_EQ(stream->columns[2], 1u);
+	EXPECT_EQ(stream->ids[3], TOKEN_IDENTIFIER);
+	EXPECT_EQ(stream->columns[3], 5u);
+	EXPECT_EQ(stream->ids[8], TOKEN_KW_DIM);
+	EXPECT_EQ(stream->lines[8], 2u) << "New lines in block comment are not counted";
+
+	const char* source = scanner->source->str;
+	EXPECT_EQ(scanner_line_offset(scanner, 1), 0u);
+	EXPECT_EQ(strncmp(source + scanner_line_offset(scanner, 2), "\tDim a", 6), 0);
+	EXPECT_EQ(strncmp(source + scanner_line_offset(scanner, 2) + stream->columns[8], "Dim B", 5), 0);
+	EXPECT_EQ(strncmp(source + scanner_line_offset(scanner, 3), "\tb = ", 5), 0);
+	EXPECT_EQ(scanner_line_offset(scanner, scanner->line), (size_t) (scanner->end - source));
+
+	token_stream_free(stream);
+}
+
+TEST_P(ScannerTestFixture, TokenizeParallel) {
+	const char* files[] = {
+		"test_files/scanner/chunks.fbc",
+		"test_files/scanner/engines.fbc",
+		"test_files/scanner/lex_err_block_comment_02.fbc",
+		"test_files/scanner/lex_err_string_01.fbc",
+	};
+
+	for (const char* file : files) {
+		if (file != files[0]) {
+			fclose(test_file);
+			scanner_free(scanner);
+			scanner = scanner_init();
+			scanner->engine = GetParam();
+		}
+		SetInputFile(file);
+		TokenStream* expected = token_stream_init();
+		scanner_tokenize(scanner, expected);
+
+		// Small chunks make comments and strings cross chunk boundaries
+		for (size_t min_chunk = 1; min_chunk <= 64; min_chunk++) {
+			FILE* chunk_file = fopen(file, "r");
+			ASSERT_NE(chunk_file, nullptr);
+			Scanner* chunk_scanner = scanner_init();
+			chunk_scanner->engine = GetParam();
+			chunk_scanner->stream = chunk_file;
+			TokenStream* stream = token_stream_init();
+			scanner_tokenize_chunks(chunk_scanner, stream, 8, min_chunk);
+
+			ASSERT_EQ(stream->count, expected->count) << file << " chunk: " << min_chunk;
+			for (size_t i = 0; i < stream->count; i++) {
+				ASSERT_EQ(stream->ids[i], expected->ids[i]) << file << " chunk: " << min_chunk << " iter: " << i;
+				EXPECT_EQ(stream->lines[i], expected->lines[i]) << file << " chunk: " << min_chunk << " iter: " << i;
+				EXPECT_EQ(stream->columns[i], expected->columns[i]) << file << " chunk: " << min_chunk << " iter: " << i;
+				if (stream->ids[i] == TOKEN_IDENTIFIER) {
+					EXPECT_EQ(stream->data[i].str, expected->data[i].str) << "Identifiers have to be interned";
+				}
+				else if (stream->ids[i] == TOKEN_STRING) {
+					EXPECT_STREQ(stream->data[i].str, expected->data[i].str);
+				}
+			}
+			ASSERT_EQ(chunk_scanner->line, scanner->line) << file << " chunk: " << min_chunk;
+			for (unsigned line = 1; line <= scanner->line; line++) {
+				EXPECT_EQ(scanner_line_offset(chunk_scanner, line), scanner_line_offset(scanner, line)) << file << " chunk: " << min_chunk;
+			}
+
+			token_stream_free(stream);
+			scanner_free(chunk_scanner);
+			fclose(chunk_file);
+		}
+
+		token_stream_free(expected);
+	}
+}
+
+TEST_P(ScannerTestFixture, Basic02) {
 	SetInputFile("test_files/syntax/basic/02.code");
 
 	token_e tokens[] = {
@@ -540,7 +744,7 @@ TEST_F(ScannerTestFixture, Basic02) {
 	}
 }
 
-TEST_F(ScannerTestFixture, Simple01) {
+TEST_P(ScannerTestFixture, Simple01) {
 	SetInputFile("test_files/scanner/simple01.fbc");
 
 	token_e tokens[] = {
@@ -562,7 +766,7 @@ TEST_F(ScannerTestFixture, Simple01) {
 	}
 }
 
-TEST_F(ScannerTestFixture, FactorialRecursive) {
+TEST_P(ScannerTestFixture, FactorialRecursive) {
 	SetInputFile("test_files/factorial_recur.fbc");
 
 	token_e tokens[] = {
@@ -608,7 +812,7 @@ TEST_F(ScannerTestFixture, FactorialRecursive) {
 	}
 }
 
-TEST_F(ScannerTestFixture, Strings) {
+TEST_P(ScannerTestFixture, Strings) {
     SetInputFile("test_files/strings.fbc");
 
     token_e tokens[] = {
@@ -646,7 +850,7 @@ TEST_F(ScannerTestFixture, Strings) {
     }
 }
 
-TEST_F(ScannerTestFixture, FactorialIterative) {
+TEST_P(ScannerTestFixture, FactorialIterative) {
 	SetInputFile("test_files/factorial_it.fbc");
 
 	Token* token = scanner_get_token(scanner);
@@ -1252,3 +1456,61 @@ TEST_F(ScannerTestFixture, FactorialIterative) {
     ) << "EOF";
 	token_free(token);
 }
+
+TEST(ScannerEngineTest, EnginesProduceSameTokens) {
+	const char* files[] = {
+		"test_files/scanner/engines.fbc",
+		"test_files/scanner/parse_int.fbc",
+		"test_files/scanner/parse_real.fbc",
+		"test_files/scanner/parse_string.fbc",
+		"test_files/scanner/simple01.fbc",
+		"test_files/scanner/keywords.fbc",
+		"test_files/scanner/lex_err_block_comment_01.fbc",
+		"test_files/scanner/lex_err_string_06.fbc",
+		"test_files/syntax/basic/02.code",
+	};
+
+	for (unsigned int i = 0; i < sizeof(files) / sizeof(char*); i++) {
+		mem_manager_init();
+		FILE* fsm_file = fopen(files[i], "r");
+		FILE* dfa_file = fopen(files[i], "r");
+		ASSERT_NE(fsm_file, nullptr) << files[i];
+		ASSERT_NE(dfa_file, nullptr) << files[i];
+
+		Scanner* fsm = scanner_init();
+		fsm->engine = SCANNER_ENGINE_FSM;
+		fsm->stream = fsm_file;
+		Scanner* dfa = scanner_init();
+		dfa->engine = SCANNER_ENGINE_DFA;
+		dfa->stream = dfa_file;
+
+		for (unsigned int iter = 0; ; iter++) {
+			Token* expected = scanner_get_token(fsm);
+			Token* actual = scanner_get_token(dfa);
+
+			ASSERT_EQ(actual->id, expected->id) << files[i] << " iter: " << iter;
+			ASSERT_EQ(dfa->line, fsm->line) << files[i] << " iter: " << iter;
+			EXPECT_EQ(dfa->token_start - dfa->source->str, fsm->token_start - fsm->source->str) << files[i] << " iter: " << iter;
+			EXPECT_EQ(scanner_line_offset(dfa, dfa->line), scanner_line_offset(fsm, fsm->line)) << files[i] << " iter: " << iter;
+			if (expected->id == TOKEN_INT) {
+				EXPECT_EQ(actual->data.i, expected->data.i) << files[i] << " iter: " << iter;
+			} else if (expected->id == TOKEN_REAL) {
+				EXPECT_DOUBLE_EQ(actual->data.d, expected->data.d) << files[i] << " iter: " << iter;
+			} else if (expected->id == TOKEN_IDENTIFIER || expected->id == TOKEN_STRING) {
+				EXPECT_STREQ(actual->data.str, expected->data.str) << files[i] << " iter: " << iter;
+			}
+
+			bool eof = expected->id == TOKEN_EOF;
+			token_free(expected);
+			token_free(actual);
+			if (eof)
+				break;
+		}
+
+		scanner_free(fsm);
+		scanner_free(dfa);
+		fclose(fsm_file);
+		fclose(dfa_file);
+		mem_manager_free();
+	}
+}
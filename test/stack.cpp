@@ -70,3 +70,30 @@ TEST_F(StackTestFixture, PushMultipleMalloc) {
 	stack_free(stack, FreeData);
 	stack = NULL;
 }
+
+TEST(SymbolStackTest, PushAndPop) {
+	mem_manager_init();
+	SymbolStack* s = symbol_stack_init(1);
+
+	// Grows over initial size
+	for (uint16_t i = 0; i < 100; i++) {
+		symbol_stack_push(s, i);
+		EXPECT_EQ(symbol_stack_top(s), i);
+	}
+
+	const uint16_t production[] = {200, 201, 202};
+	symbol_stack_push_n(s, production, 3);
+	EXPECT_EQ(s->size, 103u);
+
+	// Last symbol of array is on top
+	EXPECT_EQ(symbol_stack_pop(s), 202);
+	EXPECT_EQ(symbol_stack_pop(s), 201);
+	EXPECT_EQ(symbol_stack_pop(s), 200);
+	for (uint16_t i = 100; i > 0; i--) {
+		EXPECT_EQ(symbol_stack_pop(s), i - 1);
+	}
+	EXPECT_EQ(s->size, 0u);
+
+	symbol_stack_free(s);
+	mem_manager_free();
+}
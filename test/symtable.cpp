@@ -120,6 +120,36 @@ TEST_F(HashTableWithDataTestFixture, DeleteValidItem) {
 	EXPECT_TRUE(htab_var_remove(hash_table, keys[2])) << "Deleting valid key should return true";
 }
 
+TEST_F(HashTableTestFixture, GrowAndRemove) {
+	constexpr int n_samples = 1000;
+	char key[32];
+	htab_item* items[n_samples];
+
+	for (int i = 0; i < n_samples; i++) {
+		sprintf(key, "id%d", i);
+		items[i] = htab_var_insert(hash_table, key);
+	}
+	EXPECT_GT(hash_table->size, (size_t) n_samples) << "Table should grow";
+
+	for (int i = 0; i < n_samples; i += 2) {
+		sprintf(key, "id%d", i);
+		EXPECT_TRUE(htab_var_remove(hash_table, key));
+	}
+
+	for (int i = 0; i < n_samples; i++) {
+		sprintf(key, "id%d", i);
+		if (i % 2 == 0) {
+			EXPECT_EQ(htab_find(hash_table, key), nullptr) << key;
+		}
+		else {
+			EXPECT_EQ(htab_find(hash_table, key), items[i]) << "Items should keep their address";
+		}
+	}
+
+	htab_foreach(hash_table, foreach_count);
+	EXPECT_EQ(foreach_cnt, n_samples / 2);
+}
+
 TEST_F(HashTableTestFixture, RemoveOnEmptyTable) {
 	ASSERT_FALSE(htab_var_remove(hash_table, "nokey")) << "Empty table should return false";
 }
@@ -0,0 +1,81 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+#include "gtest/gtest.h"
+#include "token_stream.c"
+
+class TokenStreamTestFixture : public ::testing::Test {
+protected:
+	TokenStream* stream = nullptr;
+
+	virtual void SetUp() {
+		mem_manager_init();
+		stream = token_stream_init();
+	}
+
+	virtual void TearDown() {
+		token_stream_free(stream);
+		mem_manager_free();
+	}
+};
+
+TEST_F(TokenStreamTestFixture, Initialization) {
+	ASSERT_NE(stream, nullptr);
+	EXPECT_EQ(stream->count, 0u);
+	EXPECT_NE(stream->strings, nullptr);
+}
+
+TEST_F(TokenStreamTestFixture, AppendAndGet) {
+	char* str = (char*) mm_arena_alloc(stream->strings, sizeof("string"));
+	strcpy(str, "string");
+
+	Token token;
+	token.id = TOKEN_STRING;
+	token.borrowed = true;
+	token.data.str = str;
+	token_stream_append(stream, &token, 3, 7);
+
+	token.id = TOKEN_INT;
+	token.borrowed = false;
+	token.data.i = 42;
+	token_stream_append(stream, &token, 4, 0);
+
+	ASSERT_EQ(stream->count, 2u);
+
+	Token first = token_stream_get(stream, 0);
+	EXPECT_EQ(first.id, TOKEN_STRING);
+	EXPECT_TRUE(first.borrowed);
+	EXPECT_EQ(first.data.str, str);
+	EXPECT_EQ(stream->lines[0], 3u);
+	EXPECT_EQ(stream->columns[0], 7u);
+
+	Token second = token_stream_get(stream, 1);
+	EXPECT_EQ(second.id, TOKEN_INT);
+	EXPECT_EQ(second.data.i, 42);
+	EXPECT_EQ(stream->lines[1], 4u);
+	EXPECT_EQ(stream->columns[1], 0u);
+}
+
+TEST_F(TokenStreamTestFixture, Grow) {
+	Token token;
+	token.id = TOKEN_INT;
+	token.borrowed = false;
+
+	for (int i = 0; i < TOKEN_STREAM_INIT_SIZE * 3; i++) {
+		token.data.i = i;
+		token_stream_append(stream, &token, (unsigned) i / 10, (unsigned) i % 10);
+	}
+
+	ASSERT_EQ(stream->count, (size_t) TOKEN_STREAM_INIT_SIZE * 3);
+	for (int i = 0; i < TOKEN_STREAM_INIT_SIZE * 3; i++) {
+		EXPECT_EQ(token_stream_get(stream, i).data.i, i);
+		EXPECT_EQ(stream->lines[i], (unsigned) i / 10);
+		EXPECT_EQ(stream->columns[i], (unsigned) i % 10);
+	}
+}
@@ -0,0 +1,379 @@
+/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+/*
+ * Generator of constant grammar tables
+ *
+ * Reads rules and tables from src/grammar.def and src/expr_grammar.def (they are included below)
+ * and writes grammar_tables.h and expr_grammar_tables.h with statically initialized tables,
+ * so the compiler does not build them at runtime. It is built and run by CMake target grammar_tables:
+ *
+ *     gen_grammar_tables <output directory>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "grammar.h"
+#include "expr_grammar.h"
+
+#define MAX_SYMBOLS 16
+#define MAX_TRIE_NODES 255  // Node indexes have to fit in unsigned char
+
+/**
+ * Rule as it is written in definition file
+ */
+typedef struct {
+	non_terminal_e nt;  /// Non terminal of rule
+	const char* action;  /// Name of semantic action
+	const char* symbols;  /// Names of production symbols separated by commas, empty for epsilon rule
+	unsigned values[MAX_SYMBOLS];  /// Production symbols as written
+	unsigned length;  /// Number of production symbols
+	bool reverse;  /// Production has to be reversed
+} RuleDef;
+
+/**
+ * Grammar read from definition file
+ */
+typedef struct {
+	RuleDef rules[NUM_OF_RULES > NUM_OF_EXPR_RULES ? NUM_OF_RULES : NUM_OF_EXPR_RULES];  /// Rules in order they are added
+	unsigned count;  /// Number of added rules
+} GrammarDef;
+
+static GrammarDef ll_grammar;  /// Rules of LL grammar, the first rule is empty
+static GrammarDef expr_grammar_def;  /// Rules of operator-precedence grammar
+static unsigned char ll_table[NT_ENUM_SIZE][LL_TABLE_COLUMNS];  /// LL table
+static const char* precedence_rows[PT_INDEX_ENUM_SIZE];  /// Precedence table rows
+static const char* precedence_row_names[PT_INDEX_ENUM_SIZE];  /// Names of precedence table rows
+static const char* nt_names[NT_ENUM_SIZE];  /// Names of non terminals, known from rules
+static int symbol_rows[PT_SYMBOLS];  /// Precedence table row of each symbol, -1 until it is set
+static const char* symbol_names[PT_SYMBOLS];  /// Names of tokens with precedence table row
+static unsigned char reduction_trie[MAX_TRIE_NODES][EXPR_TRIE_COLUMNS];  /// Trie of expression rule productions
+static unsigned char trie_rules[MAX_TRIE_NODES];  /// Rule of trie node, EXPR_TRIE_NO_RULE if there is none
+static unsigned trie_nodes;  /// Number of trie nodes
+
+/**
+ * Print error and exit
+ * @param msg Error message
+ */
+static void fail(const char* msg) {
+	fprintf(stderr, "gen_grammar_tables: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+static void add_rule(GrammarDef* def, unsigned max_rules, non_terminal_e nt, const char* nt_name,
+					 const char* action, const char* symbols, const unsigned* values, unsigned length, bool reverse) {
+	if (def->count >= max_rules)
+		fail("Too many rules, increase NUM_OF_RULES or NUM_OF_EXPR_RULES");
+	if (length > MAX_SYMBOLS)
+		fail("Production is too long, increase MAX_SYMBOLS");
+
+	RuleDef* rule = &def->rules[def->count++];
+	rule->nt = nt;
+	rule->action = action;
+	rule->symbols = symbols;
+	memcpy(rule->values, values, sizeof(unsigned) * length);
+	rule->length = length;
+	rule->reverse = reverse;
+	nt_names[nt] = nt_name;
+}
+
+static void table_set(non_terminal_e nt, token_e token, int rule) {
+	if (rule <= 0 || rule >= NUM_OF_RULES)
+		fail("LL table refers to rule out of range");
+	if (ll_table[nt][token - TERMINALS_START] != 0)
+		fail("LL table conflict");
+
+	ll_table[nt][token - TERMINALS_START] = (unsigned char) rule;
+}
+
+static void precedence_row(pt_index_e row, const char* name, const char* items) {
+	if (strlen(items) != PT_INDEX_ENUM_SIZE)
+		fail("Precedence table row has wrong length");
+
+	precedence_rows[row] = items;
+	precedence_row_names[row] = name;
+}
+
+static void precedence_token(token_e token, const char* name, pt_index_e row) {
+	if (symbol_rows[token - TERMINALS_START] != -1)
+		fail("Token has more precedence table rows");
+
+	symbol_rows[token - TERMINALS_START] = row;
+	symbol_names[token - TERMINALS_START] = name;
+}
+
+#define ADD_EPSILON_RULE(nt) add_rule(&ll_grammar, NUM_OF_RULES, nt, #nt, "NULL", "", NULL, 0, true)
+#define ADD_RULE(nt, ...) add_rule(&ll_grammar, NUM_OF_RULES, nt, #nt, "NULL", #__VA_ARGS__, \
+		(unsigned[]) {__VA_ARGS__}, NUM_ARGS(__VA_ARGS__), true)
+#define ADD_SEMANTIC_RULE(nt, sem_action, ...) add_rule(&ll_grammar, NUM_OF_RULES, nt, #nt, #sem_action, #__VA_ARGS__, \
+		(unsigned[]) {__VA_ARGS__}, NUM_ARGS(__VA_ARGS__), true)
+#define TABLE_SET(row, column, value) table_set(row, column, value)
+#define ADD_EXPR_RULE(nt, sem_an, ...) add_rule(&expr_grammar_def, NUM_OF_EXPR_RULES, nt, #nt, #sem_an, #__VA_ARGS__, \
+		(unsigned[]) {__VA_ARGS__}, NUM_ARGS(__VA_ARGS__), false)
+#define PRECEDENCE_ROW(row, items) precedence_row(row, #row, items)
+#define PRECEDENCE_TOKEN(token, row) precedence_token(token, #token, row)
+
+/**
+ * Read definition files
+ */
+static void read_definitions() {
+	ll_grammar.count = 1;  // First index needs to be empty
+	for (unsigned i = 0; i < PT_SYMBOLS; i++)
+		symbol_rows[i] = -1;
+
+#include "grammar.def"
+
+#include "expr_grammar.def"
+
+	if (ll_grammar.count != NUM_OF_RULES || expr_grammar_def.count != NUM_OF_EXPR_RULES)
+		fail("Number of rules does not match NUM_OF_RULES or NUM_OF_EXPR_RULES");
+	for (unsigned i = 0; i < PT_INDEX_ENUM_SIZE; i++) {
+		if (precedence_rows[i] == NULL)
+			fail("Missing precedence table row");
+	}
+	for (unsigned i = 0; i < PT_SYMBOLS; i++) {
+		if (symbol_rows[i] == -1)
+			symbol_rows[i] = PT_INDEX_END_MARKER;
+	}
+}
+
+/**
+ * Build trie of expression rule productions, productions are read from the top of the stack,
+ * so they are inserted as they are written (already reversed)
+ */
+static void build_reduction_trie() {
+	trie_nodes = 1;  // Root, no node has root as its child, so 0 means there is no child
+	trie_rules[0] = EXPR_TRIE_NO_RULE;
+
+	for (unsigned i = 0; i < expr_grammar_def.count; i++) {
+		const RuleDef* rule = &expr_grammar_def.rules[i];
+		unsigned node = 0;
+		for (unsigned k = 0; k < rule->length; k++) {
+			unsigned column = rule->values[k] - NT_EXPRESSION;
+			if (rule->values[k] < NT_EXPRESSION || column >= EXPR_TRIE_COLUMNS)
+				fail("Expression rule has symbol which can not be on expression stack");
+
+			if (reduction_trie[node][column] == 0) {
+				if (trie_nodes == MAX_TRIE_NODES)
+					fail("Too many trie nodes");
+				trie_rules[trie_nodes] = EXPR_TRIE_NO_RULE;
+				reduction_trie[node][column] = (unsigned char) trie_nodes++;
+			}
+			node = reduction_trie[node][column];
+		}
+
+		if (trie_rules[node] != EXPR_TRIE_NO_RULE)
+			fail("Expression rules have the same production");
+		trie_rules[node] = (unsigned char) i;
+	}
+}
+
+/**
+ * Split production symbols
+ * @param symbols Names separated by commas
+ * @param names Array for names
+ * @param len Array for lengths of names
+ * @return number of symbols
+ */
+static unsigned split_symbols(const char* symbols, const char* names[MAX_SYMBOLS], int len[MAX_SYMBOLS]) {
+	unsigned count = 0;
+	while (*symbols != '\0') {
+		while (*symbols == ' ' || *symbols == ',')
+			symbols++;
+		if (*symbols == '\0')
+			break;
+		if (count == MAX_SYMBOLS)
+			fail("Production is too long, increase MAX_SYMBOLS");
+
+		names[count] = symbols;
+		while (*symbols != '\0' && *symbols != ',' && *symbols != ' ')
+			symbols++;
+		len[count] = (int) (symbols - names[count]);
+		count++;
+	}
+
+	return count;
+}
+
+static void print_header(FILE* f, const char* description, const char* def_file, const char* guard) {
+	fprintf(f, "/**\n"
+			" * File is part of project IFJ2017.\n"
+			" *\n"
+			" * Brno University of Technology, Faculty of Information Technology\n"
+			" *\n"
+			" * @package IFJ2017\n"
+			" * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych\n"
+			" */\n"
+			"\n"
+			"/*\n"
+			" * %s\n"
+			" *\n"
+			" * GENERATED by tools/gen_grammar_tables.c from %s, do not edit.\n"
+			" */\n"
+			"\n"
+			"#ifndef %s\n"
+			"#define %s\n"
+			"\n", description, def_file, guard, guard);
+}
+
+/**
+ * Print productions and rules
+ * @param f Output file
+ * @param def Grammar
+ * @param prefix Prefix of table names
+ * @param first Index of the first rule (previous rules are empty)
+ * @param size Name of rule count macro
+ */
+static void print_rules(FILE* f, const GrammarDef* def, const char* prefix, unsigned first, const char* size) {
+	unsigned offsets[sizeof(def->rules) / sizeof(RuleDef)];
+	unsigned lengths[sizeof(def->rules) / sizeof(RuleDef)];
+	unsigned offset = 0;
+
+	fprintf(f, "/// Productions of rules (in order they are pushed on stack), each ends by END_OF_RULE\n");
+	fprintf(f, "static const uint16_t %s_productions[] = {\n", prefix);
+	for (unsigned i = first; i < def->count; i++) {
+		const RuleDef* rule = &def->rules[i];
+		const char* names[MAX_SYMBOLS];
+		int len[MAX_SYMBOLS];
+		unsigned count = split_symbols(rule->symbols, names, len);
+
+		fprintf(f, "\t// %u: %s ->%s%s\n\t", i, nt_names[rule->nt], count == 0 ? " eps" : " ", rule->symbols);
+		for (unsigned k = 0; k < count; k++) {
+			unsigned symbol = rule->reverse ? count - k - 1 : k;
+			fprintf(f, "%.*s, ", len[symbol], names[symbol]);
+		}
+		fprintf(f, "END_OF_RULE,\n");
+
+		offsets[i] = offset;
+		lengths[i] = count;
+		offset += count + 1;
+	}
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "/// Rules of grammar\n");
+	fprintf(f, "static const Rule %s_rule_table[%s] = {\n", prefix, size);
+	for (unsigned i = 0; i < def->count; i++) {
+		const RuleDef* rule = &def->rules[i];
+		if (i < first)
+			fprintf(f, "\t{NT_ENUM_SIZE, NULL, 0, NULL},  // No rule\n");
+		else
+			fprintf(f, "\t{%s, &%s_productions[%u], %u, %s},\n", nt_names[rule->nt], prefix, offsets[i], lengths[i],
+					rule->action);
+	}
+	fprintf(f, "};\n\n");
+}
+
+static void write_grammar_tables(FILE* f) {
+	print_header(f, "Rules and LL table of the grammar", "grammar.def", "IFJ17_COMPILER_GRAMMAR_TABLES_H");
+
+	fprintf(f, "/// Tables are valid only for enums they were generated with\n");
+	fprintf(f, "typedef char grammar_tables_check[NT_ENUM_SIZE == %d && END_OF_TERMINALS == %d ? 1 : -1];\n\n",
+			NT_ENUM_SIZE, END_OF_TERMINALS);
+
+	print_rules(f, &ll_grammar, "grammar", 1, "NUM_OF_RULES");
+
+	fprintf(f, "/// LL table, NT_ENUM_SIZE rows of LL_TABLE_COLUMNS indexes to rules (0 if there is no rule)\n");
+	fprintf(f, "static const unsigned char grammar_ll_table[NT_ENUM_SIZE * LL_TABLE_COLUMNS] = {\n");
+	for (unsigned nt = 0; nt < NT_ENUM_SIZE; nt++) {
+		fprintf(f, "\t// %s", nt_names[nt] != NULL ? nt_names[nt] : "");
+		for (unsigned column = 0; column < LL_TABLE_COLUMNS; column++)
+			fprintf(f, "%s%u,", column % 20 == 0 ? "\n\t" : " ", ll_table[nt][column]);
+		fprintf(f, "\n");
+	}
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "#endif //IFJ17_COMPILER_GRAMMAR_TABLES_H\n");
+}
+
+static void write_expr_grammar_tables(FILE* f) {
+	print_header(f, "Rules and precedence table of the operator-precedence grammar", "expr_grammar.def",
+				 "IFJ17_COMPILER_EXPR_GRAMMAR_TABLES_H");
+
+	fprintf(f, "/// Tables are valid only for enums they were generated with\n");
+	fprintf(f, "typedef char expr_grammar_tables_check[NT_ENUM_SIZE == %d && TOKEN_ENUM_END == %d"
+			" && PT_INDEX_ENUM_SIZE == %d ? 1 : -1];\n\n", NT_ENUM_SIZE, TOKEN_ENUM_END, PT_INDEX_ENUM_SIZE);
+
+	print_rules(f, &expr_grammar_def, "expr_grammar", 0, "NUM_OF_EXPR_RULES");
+
+	fprintf(f, "/// Precedence table, PT_SYMBOLS rows (topmost terminal on stack) of PT_SYMBOLS items (token) of pt_item_e,\n"
+			"/// rows and columns of symbols are expanded from rows of expr_grammar.def\n");
+	fprintf(f, "static const unsigned char expr_grammar_precedence_table[PT_SYMBOLS * PT_SYMBOLS] = {\n");
+	for (unsigned top = 0; top < PT_SYMBOLS; top++) {
+		const char* row = precedence_rows[symbol_rows[top]];
+		fprintf(f, "\t// %s: %s", symbol_names[top] != NULL ? symbol_names[top] : "other",
+				precedence_row_names[symbol_rows[top]]);
+		for (unsigned token = 0; token < PT_SYMBOLS; token++) {
+			unsigned item;
+			switch (row[symbol_rows[token]]) {
+				case '<': item = EXPR_HANDLE_MARKER; break;
+				case '>': item = EXPR_REDUCE_MARKER; break;
+				case '=': item = EXPR_PUSH_MARKER; break;
+				case ' ': item = EXPR_ERROR; break;
+				default: item = EXPR_SUCCESS; break;
+			}
+			fprintf(f, "%s%u,", token % 20 == 0 ? "\n\t" : " ", item);
+		}
+		fprintf(f, "\n");
+	}
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "/// Trie of rule productions read from the top of the stack, rows of EXPR_TRIE_COLUMNS child nodes\n"
+			"/// indexed by symbol - NT_EXPRESSION (0 if there is no child)\n");
+	fprintf(f, "static const unsigned char expr_grammar_reduction_trie[%u * EXPR_TRIE_COLUMNS] = {\n", trie_nodes);
+	for (unsigned node = 0; node < trie_nodes; node++) {
+		fprintf(f, "\t// %u", node);
+		for (unsigned column = 0; column < EXPR_TRIE_COLUMNS; column++)
+			fprintf(f, "%s%u,", column % 20 == 0 ? "\n\t" : " ", reduction_trie[node][column]);
+		fprintf(f, "\n");
+	}
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "/// Rule reduced when trie node is reached after the whole handle, EXPR_TRIE_NO_RULE if there is none\n");
+	fprintf(f, "static const unsigned char expr_grammar_trie_rules[%u] = {", trie_nodes);
+	for (unsigned node = 0; node < trie_nodes; node++)
+		fprintf(f, "%s%u,", node % 20 == 0 ? "\n\t" : " ", trie_rules[node]);
+	fprintf(f, "\n};\n\n");
+
+	fprintf(f, "#endif //IFJ17_COMPILER_EXPR_GRAMMAR_TABLES_H\n");
+}
+
+/**
+ * Write table file
+ * @param dir Output directory
+ * @param name File name
+ * @param write Function writing content
+ */
+static void write_file(const char* dir, const char* name, void (*write)(FILE*)) {
+	char path[4096];
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+	FILE* f = fopen(path, "w");
+	if (f == NULL) {
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+	write(f);
+	fclose(f);
+}
+
+int main(int argc, char* argv[]) {
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s <output directory>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	read_definitions();
+	build_reduction_trie();
+	write_file(argv[1], "grammar_tables.h", write_grammar_tables);
+	write_file(argv[1], "expr_grammar_tables.h", write_expr_grammar_tables);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+Generate minimal perfect hash table of IFJ17 keywords (src/keyword_table.h).
+
+Keywords are taken from TOKEN_KW_* values in src/token.h, keyword is the lower
+case name of the token (TOKEN_KW_ELSEIF -> elseif). To add reserved word, add
+its token to token.h and run this script again:
+
+    python3 tools/gen_keyword_table.py
+
+Hash function is gperf-style:
+
+    hash = (len + asso[s[0]] + asso[s[1]] + asso[s[len - 1]]) % KEYWORD_COUNT
+
+Association values are found by randomized local search with fixed seed, so
+the output is reproducible.
+"""
+
+import os
+import random
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+TOKEN_H = os.path.join(ROOT, 'src', 'token.h')
+OUTPUT = os.path.join(ROOT, 'src', 'keyword_table.h')
+
+SEED = 1
+ATTEMPTS = 1000
+STEPS = 20000
+
+
+def read_keywords():
+    with open(TOKEN_H) as f:
+        tokens = re.findall(r'\b(TOKEN_KW_\w+)\s*,', f.read())
+    return [(token[len('TOKEN_KW_'):].lower(), token) for token in tokens]
+
+
+def key_chars(keyword):
+    return keyword[0], keyword[1], keyword[-1]
+
+
+def keyword_hash(asso, keyword, size):
+    return (len(keyword) + sum(asso[c] for c in key_chars(keyword))) % size
+
+
+def collisions(asso, keywords, size):
+    used = set()
+    count = 0
+    for keyword in keywords:
+        h = keyword_hash(asso, keyword, size)
+        if h in used:
+            count += 1
+        used.add(h)
+    return count
+
+
+def find_asso_values(keywords):
+    size = len(keywords)
+    letters = sorted(set(c for keyword in keywords for c in key_chars(keyword)))
+    rnd = random.Random(SEED)
+
+    for _ in range(ATTEMPTS):
+        asso = {c: rnd.randrange(size) for c in letters}
+        cost = collisions(asso, keywords, size)
+        for _ in range(STEPS):
+            if cost == 0:
+                return asso
+            letter = rnd.choice(letters)
+            old = asso[letter]
+            asso[letter] = rnd.randrange(size)
+            new_cost = collisions(asso, keywords, size)
+            if new_cost <= cost:
+                cost = new_cost
+            else:
+                asso[letter] = old
+
+    sys.exit('No perfect hash found, increase ATTEMPTS or STEPS')
+
+
+def format_table(values, per_line, indent='\t'):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def generate(keywords):
+    names = [keyword for keyword, _ in keywords]
+    asso = find_asso_values(names)
+    size = len(keywords)
+
+    asso_values = ['0'] * 256
+    for c, value in asso.items():
+        asso_values[ord(c)] = str(value)
+        asso_values[ord(c.upper())] = str(value)
+
+    table = [None] * size
+    for keyword, token in keywords:
+        table[keyword_hash(asso, keyword, size)] = (keyword, token)
+
+    entries = ['{"%s", %d, %s}' % (keyword, len(keyword), token) for keyword, token in table]
+
+    return TEMPLATE.format(
+        count=size,
+        min_len=min(len(k) for k in names),
+        max_len=max(len(k) for k in names),
+        asso_values=format_table(asso_values, 16),
+        keywords=format_table(entries, 1),
+    )
+
+
+TEMPLATE = '''/**
+ * File is part of project IFJ2017.
+ *
+ * Brno University of Technology, Faculty of Information Technology
+ *
+ * @package IFJ2017
+ * @authors xomach00 - Martin Omacht, xchova19 - Zdeněk Chovanec, xhendr03 - Petr Hendrych
+ */
+
+/*
+ * Minimal perfect hash table of keywords
+ *
+ * GENERATED by tools/gen_keyword_table.py from TOKEN_KW_* tokens in token.h, do not edit.
+ */
+
+#ifndef IFJ17_COMPILER_KEYWORD_TABLE_H
+#define IFJ17_COMPILER_KEYWORD_TABLE_H
+
+#include <stddef.h>
+#include "token.h"
+
+#define KEYWORD_COUNT {count}
+#define KEYWORD_MIN_LEN {min_len}
+#define KEYWORD_MAX_LEN {max_len}
+
+/**
+ * Keyword table entry
+ */
+typedef struct {{
+	const char* name;  /// Keyword in lower case
+	size_t len;  /// Length of keyword
+	token_e id;  /// Token of keyword
+}} Keyword;
+
+/// Values of characters used by keyword hash (upper and lower case letters have the same value)
+static const unsigned char keyword_asso_values[256] = {{
+{asso_values}
+}};
+
+/// Keywords indexed by their hash
+static const Keyword keyword_table[KEYWORD_COUNT] = {{
+{keywords}
+}};
+
+/**
+ * Compute keyword hash of identifier
+ * @param str identifier characters
+ * @param len length of identifier, KEYWORD_MIN_LEN <= len
+ * @return index to keyword table
+ */
+static unsigned keyword_hash(const char* str, size_t len) {{
+	return (unsigned) ((len
+			+ keyword_asso_values[(unsigned char) str[0]]
+			+ keyword_asso_values[(unsigned char) str[1]]
+			+ keyword_asso_values[(unsigned char) str[len - 1]]) % KEYWORD_COUNT);
+}}
+
+/**
+ * Get token of identifier, case insensitive
+ * @param str identifier characters (letters, digits and '_', does not have to be terminated by '\\0')
+ * @param len length of identifier
+ * @return keyword token or TOKEN_IDENTIFIER
+ */
+static token_e keyword_lookup(const char* str, size_t len) {{
+	if (len < KEYWORD_MIN_LEN || len > KEYWORD_MAX_LEN)
+		return TOKEN_IDENTIFIER;
+
+	const Keyword* keyword = &keyword_table[keyword_hash(str, len)];
+	if (keyword->len != len)
+		return TOKEN_IDENTIFIER;
+
+	// Setting 0x20 bit converts letters to lower case, digits are unchanged and '_' is never equal to a letter
+	for (size_t i = 0; i < len; i++) {{
+		if ((str[i] | 0x20) != keyword->name[i])
+			return TOKEN_IDENTIFIER;
+	}}
+
+	return keyword->id;
+}}
+
+#endif //IFJ17_COMPILER_KEYWORD_TABLE_H
+'''
+
+
+def main():
+    keywords = read_keywords()
+    if len(keywords) == 0:
+        sys.exit('No keywords found in ' + TOKEN_H)
+
+    with open(OUTPUT, 'w') as f:
+        f.write(generate(keywords))
+
+
+if __name__ == '__main__':
+    main()